@@ -0,0 +1,254 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Bench.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:25:29 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:01 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Bench.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+// * Allocation counters
+// ? every operator new of the program goes through here, operator new[] included
+// ! not inlined: once inlined GCC sees malloc/free where it expects new/delete and warns
+static unsigned long long allocationCount = 0;
+static unsigned long long allocationBytes = 0;
+
+__attribute__((noinline))
+void *operator new(size_t bytes) throw(std::bad_alloc){
+    __atomic_fetch_add(&allocationCount, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&allocationBytes, bytes, __ATOMIC_RELAXED);
+    void *block = std::malloc(bytes == 0 ? 1 : bytes);
+    if (block == NULL){
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+__attribute__((noinline))
+void operator delete(void *block) throw(){
+    std::free(block);
+}
+
+AllocationCounters allocationCounters(){
+    AllocationCounters counters;
+
+    counters.count = __atomic_load_n(&allocationCount, __ATOMIC_RELAXED);
+    counters.bytes = __atomic_load_n(&allocationBytes, __ATOMIC_RELAXED);
+    return counters;
+}
+
+// * Hardware counters
+
+static const unsigned long long perfConfigs[PERF_COUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+static const char *perfNames[PERF_COUNTERS] = {
+    "cycles",
+    "instructions",
+    "cache_misses",
+    "branch_misses"
+};
+
+// ? counts this thread and the threads it creates (inherit), in user space, from the next start()
+// ! a thread only adds its counts when it ends, the cases join their threads before run() returns
+static int openCounter(unsigned long long config){
+    struct perf_event_attr attr;
+
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.inherit = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+// * Default constructor
+PerfCounters::PerfCounters(){
+    for (int i = 0; i < PERF_COUNTERS; i++){
+        this->fds[i] = openCounter(perfConfigs[i]);
+    }
+}
+
+// * Destructor
+PerfCounters::~PerfCounters(){
+    for (int i = 0; i < PERF_COUNTERS; i++){
+        if (this->fds[i] != -1){
+            close(this->fds[i]);
+        }
+    }
+}
+
+// * Methods
+bool PerfCounters::available(int counter) const {
+    return this->fds[counter] != -1;
+}
+
+bool PerfCounters::anyAvailable() const {
+    for (int i = 0; i < PERF_COUNTERS; i++){
+        if (this->available(i)){
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerfCounters::start(){
+    for (int i = 0; i < PERF_COUNTERS; i++){
+        if (this->fds[i] != -1){
+            ioctl(this->fds[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(this->fds[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+// ? a closed counter or a failed read gives 0
+void PerfCounters::stop(unsigned long long values[PERF_COUNTERS]){
+    for (int i = 0; i < PERF_COUNTERS; i++){
+        values[i] = 0;
+        if (this->fds[i] != -1){
+            ioctl(this->fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(this->fds[i], &values[i], sizeof(values[i])) != sizeof(values[i])){
+                values[i] = 0;
+            }
+        }
+    }
+}
+
+const char *PerfCounters::name(int counter){
+    return perfNames[counter];
+}
+
+// * Default constructor
+Bench::Bench(): sink(0), failures(0){
+}
+
+// * Destructor
+Bench::~Bench(){
+}
+
+// * Methods
+double Bench::now(){
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// ? the times are per iteration, they become ns per operation here
+void Bench::record(BenchResult &result, std::vector<double> &times, const unsigned long long counters[PERF_COUNTERS]){
+    double perIteration = static_cast<double>(result.operations) / times.size();
+
+    std::sort(times.begin(), times.end());
+    result.iterations = times.size();
+    result.bestNs = times.front() * 1e9 / perIteration;
+    result.medianNs = times[times.size() / 2] * 1e9 / perIteration;
+    for (int i = 0; i < PERF_COUNTERS; i++){
+        result.counted[i] = this->perf.available(i);
+        result.counters[i] = static_cast<double>(counters[i]) / result.operations;
+    }
+    this->results.push_back(result);
+
+    std::cout << std::left << std::setw(13) << result.suite << std::setw(22) << result.name
+              << std::setw(16) << result.variant << std::right << std::setw(11) << result.size
+              << std::fixed << std::setprecision(2) << std::setw(14) << result.bestNs
+              << std::setw(14) << result.medianNs << std::setw(12) << result.allocations;
+    if (result.counted[1]){
+        std::cout << std::setw(12) << result.counters[1];
+    }
+    std::cout << std::endl;
+}
+
+void Bench::printHeader(std::ostream &out) const {
+    out << std::left << std::setw(13) << "suite" << std::setw(22) << "case"
+        << std::setw(16) << "variant" << std::right << std::setw(11) << "size"
+        << std::setw(14) << "best ns/op" << std::setw(14) << "median ns/op" << std::setw(12) << "allocs/op";
+    if (this->perf.available(1)){
+        out << std::setw(12) << "instrs/op";
+    }
+    out << std::endl;
+}
+
+static void writeString(std::ostream &out, const std::string &text){
+    out << '"';
+    for (size_t i = 0; i < text.size(); i++){
+        if (text[i] == '"' || text[i] == '\\'){
+            out << '\\';
+        }
+        out << text[i];
+    }
+    out << '"';
+}
+
+// ? one object with the machine context and an array of results, the counters that couldn't be read are null
+void Bench::writeJson(std::ostream &out) const {
+    out << std::fixed << std::setprecision(4);
+    out << "{\n  \"schema\": 1,\n  \"timestamp\": " << static_cast<long>(std::time(NULL))
+        << ",\n  \"cpus\": " << sysconf(_SC_NPROCESSORS_ONLN)
+        << ",\n  \"perf_counters\": " << (this->perf.anyAvailable() ? "true" : "false")
+        << ",\n  \"results\": [";
+    for (size_t i = 0; i < this->results.size(); i++){
+        const BenchResult &result = this->results[i];
+
+        out << (i == 0 ? "\n" : ",\n") << "    {\"suite\": ";
+        writeString(out, result.suite);
+        out << ", \"case\": ";
+        writeString(out, result.name);
+        out << ", \"variant\": ";
+        writeString(out, result.variant);
+        out << ", \"size\": " << result.size
+            << ", \"iterations\": " << result.iterations
+            << ", \"operations\": " << result.operations
+            << ", \"ns_per_op\": {\"best\": " << result.bestNs << ", \"median\": " << result.medianNs << "}"
+            << ", \"allocations_per_op\": " << result.allocations
+            << ", \"bytes_per_op\": " << result.bytes
+            << ", \"counters_per_op\": {";
+        for (int j = 0; j < PERF_COUNTERS; j++){
+            out << (j == 0 ? "" : ", ") << '"' << PerfCounters::name(j) << "\": ";
+            if (result.counted[j]){
+                out << result.counters[j];
+            } else {
+                out << "null";
+            }
+        }
+        out << "}}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+long Bench::checksum() const {
+    return this->sink;
+}
+
+const BenchResult &Bench::last() const {
+    return this->results.back();
+}
+
+void Bench::fail(const std::string &reason){
+    std::cerr << "! " << reason << std::endl;
+    this->failures++;
+}
+
+size_t Bench::failed() const {
+    return this->failures;
+}
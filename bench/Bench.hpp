@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:25:29 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:01 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_HPP
+# define BENCH_HPP
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// * Benchmark harness shared by the easyfind, Span, MutantStack and ConcurrentStack suites
+// ? every case is timed, its allocations are counted (operator new is replaced in Bench.cpp)
+// ? and the hardware counters are read around it when the kernel lets us open them
+// ? the results are printed as a table and written as JSON by writeJson()
+
+# define BENCH_MIN_ITERATIONS 3
+# define BENCH_MAX_ITERATIONS 1000
+# define BENCH_MIN_SECONDS 0.2
+
+// * Hardware counters: cycles, instructions, cache misses, branch misses
+# define PERF_COUNTERS 4
+
+// ? one perf_event per counter, user space only, a counter that doesn't open is reported as null
+// ! perf_event_paranoid > 2, seccomp or a VM without PMU leave all of them closed, the timings still work
+class PerfCounters {
+    // ! private
+    private:
+        int fds[PERF_COUNTERS];
+
+        PerfCounters(const PerfCounters &other);
+        PerfCounters &operator=(const PerfCounters &other);
+
+    // ! public
+    public:
+        // * Default constructor
+        PerfCounters();
+
+        // * Destructor
+        ~PerfCounters();
+
+        // * Methods
+        bool available(int counter) const;
+        bool anyAvailable() const;
+        void start();
+        void stop(unsigned long long values[PERF_COUNTERS]);
+        static const char *name(int counter);
+};
+
+// * Allocation counters
+// ? totals of every operator new of the program since it started
+struct AllocationCounters {
+    unsigned long long count;
+    unsigned long long bytes;
+};
+
+AllocationCounters allocationCounters();
+
+// * Result of one case
+struct BenchResult {
+    std::string suite;
+    std::string name;
+    std::string variant;
+    size_t size;
+    size_t iterations;
+    unsigned long long operations;
+    double bestNs;
+    double medianNs;
+    double allocations;
+    double bytes;
+    bool counted[PERF_COUNTERS];
+    double counters[PERF_COUNTERS];
+};
+
+// * Runner
+// ? a case is a class with:
+// ?   void setup()              not timed, called before every iteration
+// ?   long run()                timed, returns a checksum so the work isn't optimized away
+// ?   unsigned long long operations() const   operations done by one run(), the results are per operation
+class Bench {
+    // ! private
+    private:
+        std::vector<BenchResult> results;
+        PerfCounters perf;
+        long sink;
+        size_t failures;
+
+        Bench(const Bench &other);
+        Bench &operator=(const Bench &other);
+
+        void record(BenchResult &result, std::vector<double> &times, const unsigned long long counters[PERF_COUNTERS]);
+
+    // ! public
+    public:
+        // * Default constructor
+        Bench();
+
+        // * Destructor
+        ~Bench();
+
+        // * Methods
+        static double now();
+        template<typename Case>
+        void run(const std::string &suite, const std::string &name, const std::string &variant, size_t size, Case &benchCase){
+            BenchResult result;
+            std::vector<double> times;
+            unsigned long long counters[PERF_COUNTERS] = {0, 0, 0, 0};
+            unsigned long long values[PERF_COUNTERS];
+            AllocationCounters allocated = {0, 0};
+            double total = 0;
+
+            result.suite = suite;
+            result.name = name;
+            result.variant = variant;
+            result.size = size;
+            result.operations = 0;
+            while (times.size() < BENCH_MIN_ITERATIONS
+                   || (total < BENCH_MIN_SECONDS && times.size() < BENCH_MAX_ITERATIONS)){
+                benchCase.setup();
+                AllocationCounters before = allocationCounters();
+                this->perf.start();
+                double start = now();
+                this->sink += benchCase.run();
+                double elapsed = now() - start;
+                this->perf.stop(values);
+                AllocationCounters after = allocationCounters();
+
+                times.push_back(elapsed);
+                total += elapsed;
+                result.operations += benchCase.operations();
+                allocated.count += after.count - before.count;
+                allocated.bytes += after.bytes - before.bytes;
+                for (int i = 0; i < PERF_COUNTERS; i++){
+                    counters[i] += values[i];
+                }
+            }
+            result.allocations = static_cast<double>(allocated.count) / result.operations;
+            result.bytes = static_cast<double>(allocated.bytes) / result.operations;
+            this->record(result, times, counters);
+        }
+        void printHeader(std::ostream &out) const;
+        void writeJson(std::ostream &out) const;
+        long checksum() const;
+        const BenchResult &last() const;
+        // ? a suite that checks a result (kernels that must agree, allocations that must stay bounded)
+        // ? reports what went wrong here, the run goes on and the program fails at the end
+        void fail(const std::string &reason);
+        size_t failed() const;
+};
+
+// * Suites
+void easyfindSuite(Bench &bench);
+void spanSuite(Bench &bench, size_t maxSize);
+void mutantStackSuite(Bench &bench);
+void concurrentStackSuite(Bench &bench);
+
+#endif
@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ConcurrentStackBench.cpp                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 20:30:12 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:30:12 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Bench.hpp"
+#include "../ex02/MutantStack.hpp"
+#include "../ex02/ConcurrentStack.hpp"
+#include <vector>
+#include <sstream>
+#include <pthread.h>
+#include <sched.h>
+
+// * ConcurrentStack suite
+// ? push + pop pairs on one stack shared by 1 to 8 threads, against a MutantStack behind a mutex,
+// ? one operation = one pair (all threads together)
+// ? then one thread that only pushes and one that only pops: the nodes freed by the consumer must
+// ? come back to the producer through the Pool, the allocations per push must stay close to 0
+
+# define STRESS_OPS 200000
+
+# define HANDOFF_PUSHES 2000000
+# define HANDOFF_LIVE 1000
+
+// * Stress test
+// ? every thread pushes and pops STRESS_OPS times on the same stack
+class StressCase {
+    // ! private
+    private:
+        ConcurrentStack<int, NoLog> lockFree;
+        MutantStack<int, std::deque<int>, NoLog> stack;
+        pthread_mutex_t lock;
+        unsigned int threads;
+        bool locked;
+
+        StressCase(const StressCase &other);
+        StressCase &operator=(const StressCase &other);
+
+        static void *lockFreeWorker(void *arg){
+            StressCase *self = static_cast<StressCase *>(arg);
+            int value;
+
+            for (int i = 0; i < STRESS_OPS; i++){
+                self->lockFree.push(i);
+                self->lockFree.pop(value);
+            }
+            return NULL;
+        }
+
+        static void *lockedWorker(void *arg){
+            StressCase *self = static_cast<StressCase *>(arg);
+
+            for (int i = 0; i < STRESS_OPS; i++){
+                pthread_mutex_lock(&self->lock);
+                self->stack.push(i);
+                pthread_mutex_unlock(&self->lock);
+                pthread_mutex_lock(&self->lock);
+                if (!self->stack.empty()){
+                    self->stack.pop();
+                }
+                pthread_mutex_unlock(&self->lock);
+            }
+            return NULL;
+        }
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        StressCase(unsigned int threadCount, bool mutex): threads(threadCount), locked(mutex){
+            pthread_mutex_init(&this->lock, NULL);
+        }
+
+        // * Destructor
+        ~StressCase(){
+            pthread_mutex_destroy(&this->lock);
+        }
+
+        // * Methods
+        void setup(){
+        }
+
+        // ! a thread that can't be created is one worker less, the operations count them all anyway
+        long run(){
+            std::vector<pthread_t> ids(this->threads);
+            std::vector<bool> started(ids.size(), false);
+
+            for (size_t i = 0; i < ids.size(); i++){
+                started[i] = pthread_create(&ids[i], NULL, this->locked ? lockedWorker : lockFreeWorker, this) == 0;
+            }
+            for (size_t i = 0; i < ids.size(); i++){
+                if (started[i]){
+                    pthread_join(ids[i], NULL);
+                }
+            }
+            return this->locked ? this->stack.size() : this->lockFree.size();
+        }
+
+        unsigned long long operations() const {
+            return static_cast<unsigned long long>(this->threads) * STRESS_OPS;
+        }
+};
+
+// * Producer/consumer
+// ? the producer waits while more than HANDOFF_LIVE values are in the stack, so the nodes are reused
+class HandoffCase {
+    // ! private
+    private:
+        ConcurrentStack<int, NoLog> *stack;
+        int producing;
+
+        HandoffCase(const HandoffCase &other);
+        HandoffCase &operator=(const HandoffCase &other);
+
+        static void *producer(void *arg){
+            HandoffCase *self = static_cast<HandoffCase *>(arg);
+
+            for (int i = 0; i < HANDOFF_PUSHES; i++){
+                while (self->stack->size() > HANDOFF_LIVE){
+                    sched_yield();
+                }
+                self->stack->push(i);
+            }
+            __atomic_store_n(&self->producing, 0, __ATOMIC_RELEASE);
+            return NULL;
+        }
+
+        static void *consumer(void *arg){
+            HandoffCase *self = static_cast<HandoffCase *>(arg);
+            int value;
+
+            while (self->stack->pop(value) || __atomic_load_n(&self->producing, __ATOMIC_ACQUIRE)){
+            }
+            return NULL;
+        }
+
+    // ! public
+    public:
+        // * Default constructor
+        HandoffCase(): stack(NULL), producing(0){
+        }
+
+        // * Methods
+        void setup(){
+        }
+
+        // ? the stack is made and destroyed inside the timing, its own allocation is counted
+        long run(){
+            pthread_t ids[2];
+
+            this->stack = new ConcurrentStack<int, NoLog>();
+            this->producing = 1;
+            pthread_create(&ids[0], NULL, consumer, this);
+            pthread_create(&ids[1], NULL, producer, this);
+            pthread_join(ids[1], NULL);
+            pthread_join(ids[0], NULL);
+            delete this->stack;
+            this->stack = NULL;
+            return HANDOFF_PUSHES;
+        }
+
+        unsigned long long operations() const {
+            return HANDOFF_PUSHES;
+        }
+};
+
+void concurrentStackSuite(Bench &bench){
+    for (unsigned int threads = 1; threads <= 8; threads *= 2){
+        std::ostringstream variant;
+        variant << "lock-free x" << threads;
+        StressCase lockFree(threads, false);
+
+        bench.run("Concurrent", "push + pop", variant.str(), STRESS_OPS, lockFree);
+
+        variant.str("");
+        variant << "mutex x" << threads;
+        StressCase locked(threads, true);
+
+        bench.run("Concurrent", "push + pop", variant.str(), STRESS_OPS, locked);
+    }
+
+    HandoffCase handoff;
+
+    bench.run("Concurrent", "producer/consumer", "pool reuse", HANDOFF_PUSHES, handoff);
+    // ! the pool reuse is checked, not only measured: it fails when the allocations follow the pushes
+    if (bench.last().allocations >= 0.01){
+        bench.fail("ConcurrentStack: the producer/consumer allocations are not bounded");
+    }
+}
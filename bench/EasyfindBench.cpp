@@ -0,0 +1,223 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   EasyfindBench.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:25:29 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:02 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Bench.hpp"
+#include "../ex00/easyfind.hpp"
+#include "../ex00/FindIndex.hpp"
+#include "../ex00/FindEngine.hpp"
+#include <vector>
+#include <deque>
+#include <list>
+#include <set>
+#include <cstdlib>
+
+// * easyfind suite
+// ? one lookup per operation, for every container type, with the value early, in the middle,
+// ? late in the iteration order of the container, or missing
+// ? then the search kernels of a vector alone (scalar and vectorized) and easyfind_parallel, on big vectors
+
+# define FIND_LOOKUPS (1 << 20)
+
+static const char *positions[] = {"early", "middle", "late", "missing"};
+
+// ? the value at `index` in the iteration order, or one that isn't in the container
+template<typename Container>
+static int keyAt(const Container &container, size_t size, int position){
+    typename Container::const_iterator it = container.begin();
+
+    switch (position){
+        case 0:
+            std::advance(it, size / 100);
+            break;
+        case 1:
+            std::advance(it, size / 2);
+            break;
+        case 2:
+            std::advance(it, size - 1);
+            break;
+        default:
+            return static_cast<int>(size);
+    }
+    return *it;
+}
+
+template<typename Container>
+typename Container::const_iterator plainFind(const Container &container, const int num){
+    return easyfind(container, num, std::nothrow);
+}
+
+template<typename Container>
+typename Container::const_iterator sortedFind(const Container &container, const int num){
+    return easyfind(container, num, assumeSorted, std::nothrow);
+}
+
+// ? the kernels behind the easyfind of a vector, called directly so the dispatch isn't measured
+template<const int *(*kernel)(const int *, const int *, int)>
+std::vector<int>::const_iterator kernelFind(const std::vector<int> &container, const int num){
+    const int *first = &container[0];
+
+    return container.begin() + (kernel(first, first + container.size(), num) - first);
+}
+
+template<unsigned int threads>
+std::vector<int>::const_iterator threadedFind(const std::vector<int> &container, const int num){
+    return easyfind_parallel(container, num, threads, std::nothrow);
+}
+
+// ? `lookups` searches of the same value, so the small containers don't measure the timer
+// ! the value is read back through a volatile, the compiler can't hoist the search out of the loop
+template<typename Container>
+class FindCase {
+    // ! private
+    private:
+        typedef typename Container::const_iterator (*Finder)(const Container &, const int);
+
+        const Container &container;
+        volatile int key;
+        size_t lookups;
+        Finder finder;
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        FindCase(const Container &searched, int num, size_t count, Finder find):
+            container(searched), key(num), lookups(count), finder(find){
+        }
+
+        // * Methods
+        void setup(){
+        }
+
+        long run(){
+            long found = 0;
+
+            for (size_t i = 0; i < this->lookups; i++){
+                found += this->finder(this->container, this->key) != this->container.end();
+            }
+            return found;
+        }
+
+        unsigned long long operations() const {
+            return this->lookups;
+        }
+};
+
+// ? same as FindCase through a FindIndex built before the timing
+template<typename Container>
+class IndexCase {
+    // ! private
+    private:
+        FindIndex<Container, NoLog> &index;
+        const Container &container;
+        volatile int key;
+        size_t lookups;
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        IndexCase(FindIndex<Container, NoLog> &built, const Container &searched, int num, size_t count):
+            index(built), container(searched), key(num), lookups(count){
+        }
+
+        // * Methods
+        void setup(){
+        }
+
+        long run(){
+            long found = 0;
+
+            for (size_t i = 0; i < this->lookups; i++){
+                found += this->index.find(this->key, std::nothrow) != this->container.end();
+            }
+            return found;
+        }
+
+        unsigned long long operations() const {
+            return this->lookups;
+        }
+};
+
+template<typename Container>
+static void findCases(Bench &bench, const std::string &name, const Container &container, size_t size,
+                      typename Container::const_iterator (*finder)(const Container &, const int)){
+    for (int position = 0; position < 4; position++){
+        FindCase<Container> benchCase(container, keyAt(container, size, position),
+                                      std::max(static_cast<size_t>(1), FIND_LOOKUPS / size), finder);
+
+        bench.run("easyfind", name, positions[position], size, benchCase);
+    }
+}
+
+void easyfindSuite(Bench &bench){
+    static const size_t sizes[] = {1000, 1000000};
+
+    std::srand(42);
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+        size_t size = sizes[s];
+        std::vector<int> shuffled(size);
+        std::vector<int> sorted(size);
+
+        for (size_t i = 0; i < size; i++){
+            shuffled[i] = static_cast<int>(i);
+            sorted[i] = static_cast<int>(i);
+        }
+        std::random_shuffle(shuffled.begin(), shuffled.end());
+
+        std::deque<int> deque(shuffled.begin(), shuffled.end());
+        std::list<int> list(shuffled.begin(), shuffled.end());
+        std::set<int> set(shuffled.begin(), shuffled.end());
+
+        findCases(bench, "vector", shuffled, size, plainFind<std::vector<int> >);
+        findCases(bench, "deque", deque, size, plainFind<std::deque<int> >);
+        findCases(bench, "list", list, size, plainFind<std::list<int> >);
+        findCases(bench, "set", set, size, plainFind<std::set<int> >);
+        findCases(bench, "sorted vector", sorted, size, sortedFind<std::vector<int> >);
+
+        FindIndex<std::vector<int>, NoLog> index(shuffled);
+
+        for (int position = 0; position < 4; position++){
+            IndexCase<std::vector<int> > benchCase(index, shuffled, keyAt(shuffled, size, position),
+                                                   std::max(static_cast<size_t>(1), FIND_LOOKUPS / size));
+
+            bench.run("easyfind", "vector + FindIndex", positions[position], size, benchCase);
+        }
+    }
+
+    // ? below PARALLEL_FIND_THRESHOLD easyfind_parallel searches alone, the first size shows that cost
+    static const size_t bigSizes[] = {1000000, 16000000};
+
+    for (size_t s = 0; s < sizeof(bigSizes) / sizeof(bigSizes[0]); s++){
+        size_t size = bigSizes[s];
+        std::vector<int> shuffled(size);
+
+        for (size_t i = 0; i < size; i++){
+            shuffled[i] = static_cast<int>(i);
+        }
+        std::random_shuffle(shuffled.begin(), shuffled.end());
+
+        // ! the kernels and the threads must find the same element as std::find
+        for (int position = 0; position < 4; position++){
+            int key = keyAt(shuffled, size, position);
+            std::vector<int>::const_iterator expected = std::find(shuffled.begin(), shuffled.end(), key);
+
+            if (kernelFind<findScalar>(shuffled, key) != expected || kernelFind<findVector>(shuffled, key) != expected
+                || threadedFind<4>(shuffled, key) != expected){
+                bench.fail("easyfind: the kernels don't agree with std::find");
+            }
+        }
+        findCases(bench, "vector, scalar kernel", shuffled, size, kernelFind<findScalar>);
+        findCases(bench, "vector, vector kernel", shuffled, size, kernelFind<findVector>);
+        findCases(bench, "parallel, 2 threads", shuffled, size, threadedFind<2>);
+        findCases(bench, "parallel, 4 threads", shuffled, size, threadedFind<4>);
+        findCases(bench, "parallel, 8 threads", shuffled, size, threadedFind<8>);
+    }
+}
@@ -0,0 +1,251 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MutantStackBench.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:25:29 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:02 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Bench.hpp"
+#include "../ex02/MutantStack.hpp"
+#include <vector>
+#include <deque>
+#include <streambuf>
+
+// * MutantStack suite
+// ? push, pop and iteration for every storage, one operation = one element
+// ? the range push and pop are the bulk operations of MutantStack, the same elements in one call
+// ? the small stacks are repeated so one run isn't only the timer, the stacks don't log (NoLog)
+// ? then short-lived stacks built and destroyed by batches (one operation = one stack), over the arena,
+// ? the pool and with every logging policy
+
+# define STACK_ELEMENTS 100000
+
+enum StackMode {
+    Push,
+    PushRange,
+    Pop,
+    PopRange,
+    Iterate
+};
+
+static const char *stackCases[] = {"push", "push range", "pop", "pop range", "iterate"};
+
+template<typename Stack>
+class StackCase {
+    // ! private
+    private:
+        typedef typename Stack::container_type::allocator_type allocator_type;
+
+        allocator_type allocator;
+        size_t size;
+        size_t repeat;
+        StackMode mode;
+        std::vector<Stack *> stacks;
+        std::vector<int> elements;
+
+        StackCase(const StackCase &other);
+        StackCase &operator=(const StackCase &other);
+
+        // * Helpers
+        void release(){
+            for (size_t i = 0; i < this->stacks.size(); i++){
+                delete this->stacks[i];
+            }
+            this->stacks.clear();
+        }
+
+        void fill(size_t count){
+            this->release();
+            for (size_t i = 0; i < count; i++){
+                this->stacks.push_back(new Stack(this->allocator));
+                for (size_t j = 0; j < this->size; j++){
+                    this->stacks[i]->push(static_cast<int>(j));
+                }
+            }
+        }
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        StackCase(const allocator_type &source, size_t count, StackMode what):
+            allocator(source), size(count), repeat(std::max(static_cast<size_t>(1), STACK_ELEMENTS / count)), mode(what),
+            elements(count){
+            for (size_t i = 0; i < count; i++){
+                this->elements[i] = static_cast<int>(i);
+            }
+            if (this->mode == Iterate){
+                this->fill(1);
+            }
+        }
+
+        // * Destructor
+        ~StackCase(){
+            this->release();
+        }
+
+        // * Methods
+        // ? the pops get full stacks built outside the timing
+        void setup(){
+            if (this->mode == Pop || this->mode == PopRange){
+                this->fill(this->repeat);
+            }
+        }
+
+        long run(){
+            long sum = 0;
+
+            for (size_t r = 0; r < this->repeat; r++){
+                if (this->mode == Push){
+                    Stack stack(this->allocator);
+
+                    for (size_t i = 0; i < this->size; i++){
+                        stack.push(static_cast<int>(i));
+                    }
+                    sum += stack.top();
+                } else if (this->mode == PushRange){
+                    Stack stack(this->allocator);
+
+                    stack.push_range(this->elements.begin(), this->elements.end());
+                    sum += stack.top();
+                } else if (this->mode == Pop){
+                    Stack &stack = *this->stacks[r];
+
+                    while (!stack.empty()){
+                        sum += stack.top();
+                        stack.pop();
+                    }
+                } else if (this->mode == PopRange){
+                    this->stacks[r]->pop(this->size, this->elements.begin());
+                    sum += this->elements[0];
+                } else {
+                    const Stack &stack = *this->stacks[0];
+
+                    for (typename Stack::const_iterator it = stack.begin(); it != stack.end(); ++it){
+                        sum += *it;
+                    }
+                }
+            }
+            return sum;
+        }
+
+        unsigned long long operations() const {
+            return static_cast<unsigned long long>(this->repeat) * this->size;
+        }
+};
+
+// * Short-lived stacks
+// ? a batch of STACK_BATCH stacks of STACK_BATCH_ELEMENTS elements, all alive together, then all destroyed
+// ? an arena gives the memory of the whole batch back at once after it
+# define STACK_BATCH 1000
+# define STACK_BATCH_ELEMENTS 16
+
+// ? where the CoutLog lines go while they are measured: they are formatted, then dropped
+class DiscardBuffer: public std::streambuf {
+    // ! protected
+    protected:
+        int overflow(int c){
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char *, std::streamsize count){
+            return count;
+        }
+};
+
+template<typename Stack>
+class BatchCase {
+    // ! private
+    private:
+        typedef typename Stack::container_type::allocator_type allocator_type;
+
+        allocator_type allocator;
+        Arena *arena;
+        std::vector<Stack *> stacks;
+        DiscardBuffer discard;
+
+        BatchCase(const BatchCase &other);
+        BatchCase &operator=(const BatchCase &other);
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        BatchCase(const allocator_type &source, Arena *reset): allocator(source), arena(reset), stacks(STACK_BATCH){
+        }
+
+        // * Methods
+        void setup(){
+        }
+
+        long run(){
+            std::streambuf *previous = std::cout.rdbuf(&this->discard);
+            long sum = 0;
+
+            for (size_t i = 0; i < this->stacks.size(); i++){
+                this->stacks[i] = new Stack(this->allocator);
+                for (int j = 0; j < STACK_BATCH_ELEMENTS; j++){
+                    this->stacks[i]->push(j);
+                }
+            }
+            for (size_t i = 0; i < this->stacks.size(); i++){
+                sum += this->stacks[i]->top();
+                delete this->stacks[i];
+            }
+            if (this->arena != NULL){
+                this->arena->reset();
+            }
+            std::cout.rdbuf(previous);
+            return sum;
+        }
+
+        unsigned long long operations() const {
+            return this->stacks.size();
+        }
+};
+
+template<typename Stack>
+static void batchCase(Bench &bench, const std::string &name, const typename Stack::container_type::allocator_type &allocator,
+                      Arena *arena){
+    BatchCase<Stack> benchCase(allocator, arena);
+
+    bench.run("MutantStack", "short-lived", name, STACK_BATCH_ELEMENTS, benchCase);
+}
+
+template<typename Stack>
+static void storageCases(Bench &bench, const std::string &name, const typename Stack::container_type::allocator_type &allocator){
+    static const size_t sizes[] = {16, 1024, 1000000};
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++){
+        for (int mode = Push; mode <= Iterate; mode++){
+            StackCase<Stack> benchCase(allocator, sizes[s], static_cast<StackMode>(mode));
+
+            bench.run("MutantStack", stackCases[mode], name, sizes[s], benchCase);
+        }
+    }
+}
+
+void mutantStackSuite(Bench &bench){
+    storageCases<MutantStack<int, std::deque<int>, NoLog> >(bench, "deque", std::allocator<int>());
+    storageCases<MutantStack<int, std::deque<int, PoolAllocator<int> >, NoLog> >(bench, "deque + pool", PoolAllocator<int>());
+    storageCases<MutantStack<int, std::vector<int>, NoLog> >(bench, "vector", std::allocator<int>());
+    storageCases<MutantStack<int, std::vector<int, PoolAllocator<int> >, NoLog> >(bench, "vector + pool", PoolAllocator<int>());
+    storageCases<MutantStack<int, SmallVector<int>, NoLog> >(bench, "smallvector", std::allocator<int>());
+    storageCases<MutantStack<int, SmallVector<int, 32, PoolAllocator<int> >, NoLog> >(bench, "smallvector + pool", PoolAllocator<int>());
+
+    Arena arena;
+
+    batchCase<MutantStack<int, std::deque<int>, NoLog> >(bench, "deque", std::allocator<int>(), NULL);
+    batchCase<MutantStack<int, std::deque<int, ArenaAllocator<int> >, NoLog> >(bench, "deque + arena", ArenaAllocator<int>(arena), &arena);
+    batchCase<MutantStack<int, std::deque<int, PoolAllocator<int> >, NoLog> >(bench, "deque + pool", PoolAllocator<int>(), NULL);
+    batchCase<MutantStack<int, std::vector<int>, NoLog> >(bench, "vector", std::allocator<int>(), NULL);
+    batchCase<MutantStack<int, std::vector<int, ArenaAllocator<int> >, NoLog> >(bench, "vector + arena", ArenaAllocator<int>(arena), &arena);
+    batchCase<MutantStack<int, std::vector<int, PoolAllocator<int> >, NoLog> >(bench, "vector + pool", PoolAllocator<int>(), NULL);
+    batchCase<MutantStack<int, SmallVector<int>, NoLog> >(bench, "smallvector", std::allocator<int>(), NULL);
+    batchCase<MutantStack<int, SmallVector<int, 32, PoolAllocator<int> >, NoLog> >(bench, "smallvector + pool", PoolAllocator<int>(), NULL);
+    batchCase<MutantStack<int, std::deque<int>, CoutLog> >(bench, "deque, cout log", std::allocator<int>(), NULL);
+    batchCase<MutantStack<int, std::deque<int>, CountingLog> >(bench, "deque, count log", std::allocator<int>(), NULL);
+}
@@ -0,0 +1,284 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SpanBench.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:25:29 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:02 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Bench.hpp"
+#include "../ex01/Span.hpp"
+#include "../ex01/SpanEngine.hpp"
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+
+// * Span suite
+// ? insert throughput (one operation = one number) and query latency (one operation = one query)
+// ? from 10 numbers up to maxSize, the small spans are repeated so one run isn't only the timer
+// ? the first queries of the big spans again with setThreads(), then the kernels of SpanEngine alone
+// ? (one operation = one number): the scalar and vectorized reductions, std::sort and the radix sort
+
+# define SPAN_NUMBERS 100000
+
+enum SpanMode {
+    AddNumber,
+    AddNumbers,
+    ShortestCold,
+    ShortestCached,
+    LongestCold,
+    LongestCached
+};
+
+static const char *spanCases[] = {"addNumber", "addNumbers", "shortestSpan", "shortestSpan", "longestSpan", "longestSpan"};
+static const char *spanVariants[] = {"one by one", "range", "first query", "cached", "first query", "cached"};
+
+class SpanCase {
+    // ! private
+    private:
+        const std::vector<int> &numbers;
+        size_t size;
+        size_t repeat;
+        SpanMode mode;
+        unsigned int threads;
+        std::vector<Span> spans;
+
+        SpanCase(const SpanCase &other);
+        SpanCase &operator=(const SpanCase &other);
+
+        // * Helpers
+        // ? every span reserves its own storage, no temporary Span(size) is reserved to be copied
+        void fill(){
+            this->spans.clear();
+            this->spans.resize(this->repeat);
+            for (size_t i = 0; i < this->repeat; i++){
+                this->spans[i] = Span(this->size);
+                this->spans[i].setThreads(this->threads);
+                this->spans[i].addNumbers(this->numbers.begin(), this->numbers.begin() + this->size);
+            }
+        }
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        SpanCase(const std::vector<int> &source, size_t count, SpanMode what, unsigned int threadCount = 1):
+            numbers(source), size(count), repeat(std::max(static_cast<size_t>(1), SPAN_NUMBERS / count)), mode(what),
+            threads(threadCount){
+            // ? the cached queries answer from the sort of a first query done here, on one span whatever its size
+            if (this->mode == ShortestCached || this->mode == LongestCached){
+                this->repeat = 1;
+                this->fill();
+                this->repeat = SPAN_NUMBERS;
+                this->spans[0].shortestSpan();
+            }
+        }
+
+        // * Methods
+        // ? the first queries get spans that were never queried, built outside the timing
+        void setup(){
+            if (this->mode == ShortestCold || this->mode == LongestCold){
+                this->fill();
+            }
+        }
+
+        long run(){
+            long sum = 0;
+
+            for (size_t r = 0; r < this->repeat; r++){
+                switch (this->mode){
+                    case AddNumber: {
+                        Span span(this->size);
+
+                        for (size_t i = 0; i < this->size; i++){
+                            span.addNumber(this->numbers[i]);
+                        }
+                        sum += span.longestSpan();
+                        break;
+                    }
+                    case AddNumbers: {
+                        Span span(this->size);
+
+                        span.addNumbers(this->numbers.begin(), this->numbers.begin() + this->size);
+                        sum += span.longestSpan();
+                        break;
+                    }
+                    case ShortestCold:
+                        sum += this->spans[r].shortestSpan();
+                        break;
+                    case LongestCold:
+                        sum += this->spans[r].longestSpan();
+                        break;
+                    case ShortestCached:
+                        sum += this->spans[0].shortestSpan();
+                        break;
+                    case LongestCached:
+                        sum += this->spans[0].longestSpan();
+                        break;
+                }
+            }
+            return sum;
+        }
+
+        // ? the inserts count numbers, the queries count queries
+        unsigned long long operations() const {
+            if (this->mode == AddNumber || this->mode == AddNumbers){
+                return static_cast<unsigned long long>(this->repeat) * this->size;
+            }
+            return this->repeat;
+        }
+};
+
+// * Kernels of SpanEngine
+enum KernelMode {
+    GapScalar,
+    GapVector,
+    MinMaxScalar,
+    MinMaxVector,
+    StdSort,
+    RadixSort
+};
+
+static const char *kernelCases[] = {"gap", "gap", "min max", "min max", "sort", "sort"};
+static const char *kernelVariants[] = {"scalar", "vector", "scalar", "vector", "std::sort", "radix"};
+
+// ? the reductions read sorted numbers, the sorts get a shuffled copy put back outside the timing
+class KernelCase {
+    // ! private
+    private:
+        const std::vector<int> &numbers;
+        size_t size;
+        KernelMode mode;
+        std::vector<int> work;
+        std::vector<int> scratch;
+
+        KernelCase(const KernelCase &other);
+        KernelCase &operator=(const KernelCase &other);
+
+    // ! public
+    public:
+        // * Parametrised constructor
+        KernelCase(const std::vector<int> &source, size_t count, KernelMode what):
+            numbers(source), size(count), mode(what){
+            if (this->mode == StdSort || this->mode == RadixSort){
+                this->work.resize(count);
+                this->scratch.resize(count);
+            }
+        }
+
+        // * Methods
+        void setup(){
+            if (this->mode == StdSort || this->mode == RadixSort){
+                std::copy(this->numbers.begin(), this->numbers.begin() + this->size, this->work.begin());
+            }
+        }
+
+        long run(){
+            const int *first = &this->numbers[0];
+            const int *last = first + this->size;
+            int min = first[0];
+            int max = first[0];
+
+            switch (this->mode){
+                case GapScalar:
+                    return gapScalar(first + 1, last);
+                case GapVector:
+                    return gapVector(first + 1, last);
+                case MinMaxScalar:
+                    minMaxScalar(first, last, min, max);
+                    break;
+                case MinMaxVector:
+                    minMaxVector(first, last, min, max);
+                    break;
+                case StdSort:
+                    std::sort(this->work.begin(), this->work.end());
+                    return this->work[this->size / 2];
+                case RadixSort:
+                    radixSort(&this->work[0], &this->work[0] + this->size, &this->scratch[0]);
+                    return this->work[this->size / 2];
+            }
+            return static_cast<long>(max) - min;
+        }
+
+        unsigned long long operations() const {
+            return this->size;
+        }
+};
+
+// ! the vectorized kernels must give the scalar results and the radix sort the order of std::sort
+static void checkKernels(Bench &bench, const std::vector<int> &sorted, const std::vector<int> &shuffled, size_t size){
+    const int *first = &sorted[0];
+    int scalarMin = first[0];
+    int scalarMax = first[0];
+    int vectorMin = first[0];
+    int vectorMax = first[0];
+    std::vector<int> expected(shuffled.begin(), shuffled.begin() + size);
+    std::vector<int> radix(expected);
+    std::vector<int> scratch(size);
+
+    minMaxScalar(first, first + size, scalarMin, scalarMax);
+    minMaxVector(first, first + size, vectorMin, vectorMax);
+    if (gapScalar(first + 1, first + size) != gapVector(first + 1, first + size)
+        || scalarMin != vectorMin || scalarMax != vectorMax){
+        bench.fail("Span: the vectorized reductions don't agree with the scalar ones");
+    }
+    std::sort(expected.begin(), expected.end());
+    radixSort(&radix[0], &radix[0] + size, &scratch[0]);
+    if (radix != expected){
+        bench.fail("Span: the radix sort doesn't agree with std::sort");
+    }
+}
+
+static void engineCases(Bench &bench, size_t maxSize){
+    // ? sorted numbers with no duplicates, so the scalar gap loop can't stop early
+    std::vector<int> sorted(maxSize);
+    for (size_t i = 0; i < maxSize; i++){
+        sorted[i] = static_cast<int>(i % 500000000) * 4 + std::rand() % 3;
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<int> shuffled(sorted);
+    std::random_shuffle(shuffled.begin(), shuffled.end());
+
+    for (size_t size = 1000000; size <= maxSize; size *= 10){
+        checkKernels(bench, sorted, shuffled, size);
+        for (int mode = GapScalar; mode <= RadixSort; mode++){
+            KernelCase benchCase(mode < StdSort ? sorted : shuffled, size, static_cast<KernelMode>(mode));
+
+            bench.run("Span", kernelCases[mode], kernelVariants[mode], size, benchCase);
+        }
+        if (size > maxSize / 10){
+            break;
+        }
+    }
+}
+
+void spanSuite(Bench &bench, size_t maxSize){
+    std::vector<int> numbers(maxSize);
+
+    std::srand(42);
+    for (size_t i = 0; i < maxSize; i++){
+        numbers[i] = std::rand();
+    }
+    for (size_t size = 10; size <= maxSize; size *= 10){
+        for (int mode = AddNumber; mode <= LongestCached; mode++){
+            SpanCase benchCase(numbers, size, static_cast<SpanMode>(mode));
+
+            bench.run("Span", spanCases[mode], spanVariants[mode], size, benchCase);
+        }
+        // ? the sort and the gap scan are split between the threads from PARALLEL_THRESHOLD numbers
+        for (unsigned int threads = 2; size >= PARALLEL_THRESHOLD && threads <= 8; threads *= 2){
+            std::ostringstream variant;
+            variant << "first query x" << threads;
+            SpanCase benchCase(numbers, size, ShortestCold, threads);
+
+            bench.run("Span", "shortestSpan", variant.str(), size, benchCase);
+        }
+        if (size > maxSize / 10){
+            break;
+        }
+    }
+    engineCases(bench, maxSize);
+}
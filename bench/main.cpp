@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:25:29 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:25:29 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Bench.hpp"
+#include <fstream>
+#include <cstdlib>
+
+// * Benchmark suite of easyfind, Span, MutantStack and ConcurrentStack
+// ? usage: ./benchmarks [output.json [max span size]]   (default bench.json 100000000)
+// ? the table goes to stdout, the same results go to the JSON file
+// ! the program fails when a check of a suite failed, the JSON is written anyway
+
+int main(int argc, char **argv){
+    const char *output = argc > 1 ? argv[1] : "bench.json";
+    size_t maxSize = argc > 2 ? std::strtoul(argv[2], NULL, 10) : 100000000;
+    Bench bench;
+
+    if (maxSize < 10){
+        std::cerr << "The max span size must be at least 10" << std::endl;
+        return 1;
+    }
+    bench.printHeader(std::cout);
+    easyfindSuite(bench);
+    spanSuite(bench, maxSize);
+    mutantStackSuite(bench);
+    concurrentStackSuite(bench);
+
+    std::ofstream file(output);
+    if (!file){
+        std::cerr << "Can't write " << output << std::endl;
+        return 1;
+    }
+    bench.writeJson(file);
+    std::cout << "results written to " << output << " (checksum " << bench.checksum() << ")" << std::endl;
+    if (bench.failed()){
+        std::cerr << bench.failed() << " check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
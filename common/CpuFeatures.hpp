@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   CpuFeatures.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 20:41:55 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:41:55 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CPUFEATURES_HPP
+# define CPUFEATURES_HPP
+
+// ? one probe of the instruction sets for the vectorized kernels of the exercises (ex00, ex01)
+
+// * Includes
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+# define CPU_X86 1
+#else
+# define CPU_X86 0
+#endif
+
+// * Instruction sets a kernel can be written for, from the oldest to the widest
+enum CpuLevel {
+    CpuScalar,
+    CpuSse2,
+    CpuAvx2
+};
+
+// * Functions
+inline CpuLevel probeCpuLevel(){
+#if CPU_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")){
+        return CpuAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")){
+        return CpuSse2;
+    }
+#endif
+    return CpuScalar;
+}
+
+// ? the CPU doesn't change while the program runs, it's probed on the first call only
+// ! a local static is initialized once even when several threads make the first call together
+inline CpuLevel cpuLevel(){
+    static CpuLevel level = probeCpuLevel();
+
+    return level;
+}
+
+// ? the kernel written for the widest instruction set this CPU has
+template<typename Kernel>
+Kernel pickKernel(Kernel avx2, Kernel sse2, Kernel scalar){
+    switch (cpuLevel()){
+        case CpuAvx2:
+            return avx2;
+        case CpuSse2:
+            return sse2;
+        case CpuScalar:
+            break;
+    }
+    return scalar;
+}
+
+#endif
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Lifecycle.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:18:36 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:13:12 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LIFECYCLE_HPP
+# define LIFECYCLE_HPP
+
+// ? one copy for every exercise that logs a lifecycle (ex00, ex01, ex02), they include it from ../common
+
+// * Includes
+#include <iostream>
+#include <cstddef>
+
+// * Events of the life of an object
+enum LifecycleEvent {
+    DefaultConstructed,
+    Constructed,
+    CopyConstructed,
+    CopyAssigned,
+    MoveConstructed,
+    MoveAssigned,
+    Destroyed
+};
+
+// * Counters of one class, see CountingLog
+// ? one counter per event (a copy constructor that calls the copy assignment operator counts in both)
+// ? bytes: memory the objects asked for themselves (not the memory of the members they hold)
+struct LifecycleCounters {
+    unsigned long defaultConstructed;
+    unsigned long constructed;
+    unsigned long copyConstructed;
+    unsigned long copyAssigned;
+    unsigned long moveConstructed;
+    unsigned long moveAssigned;
+    unsigned long destroyed;
+    unsigned long bytes;
+};
+
+// * Policies
+// ? a class tells its policy what happens to it with event<Class>(name, event) and allocated<Class>(bytes)
+// ? CoutLog: one line on std::cout per event, the historical behaviour
+// ? NoLog: nothing, the calls are empty and compiled out
+// ? CountingLog: relaxed atomic counters per class, read with CountingLog::counters<Class>()
+struct CoutLog {
+    template<typename Class>
+    static void event(const char *name, LifecycleEvent event){
+        switch (event){
+            case DefaultConstructed:
+                std::cout << "Default constructor of " << name << " is called" << std::endl;
+                break;
+            case Constructed:
+                std::cout << "Parametrised constructor of " << name << " is called" << std::endl;
+                break;
+            case CopyConstructed:
+                std::cout << "Copy constructor of " << name << " is called" << std::endl;
+                break;
+            case CopyAssigned:
+                std::cout << "Copy assignment operator of " << name << " is called" << std::endl;
+                break;
+            case MoveConstructed:
+                std::cout << "Move constructor of " << name << " is called" << std::endl;
+                break;
+            case MoveAssigned:
+                std::cout << "Move assignment operator of " << name << " is called" << std::endl;
+                break;
+            case Destroyed:
+                std::cout << name << " is destroyed" << std::endl;
+                break;
+        }
+    }
+
+    template<typename Class>
+    static void allocated(size_t){
+    }
+};
+
+struct NoLog {
+    template<typename Class>
+    static void event(const char *, LifecycleEvent){
+    }
+
+    template<typename Class>
+    static void allocated(size_t){
+    }
+};
+
+struct CountingLog {
+    // ! private
+    private:
+        // ? one zero initialized block per class, shared by every translation unit
+        template<typename Class>
+        static LifecycleCounters &storage(){
+            static LifecycleCounters counters;
+
+            return counters;
+        }
+
+        static unsigned long *field(LifecycleCounters &counters, LifecycleEvent event){
+            switch (event){
+                case DefaultConstructed:
+                    return &counters.defaultConstructed;
+                case Constructed:
+                    return &counters.constructed;
+                case CopyConstructed:
+                    return &counters.copyConstructed;
+                case CopyAssigned:
+                    return &counters.copyAssigned;
+                case MoveConstructed:
+                    return &counters.moveConstructed;
+                case MoveAssigned:
+                    return &counters.moveAssigned;
+                case Destroyed:
+                    break;
+            }
+            return &counters.destroyed;
+        }
+
+    // ! public
+    public:
+        template<typename Class>
+        static void event(const char *, LifecycleEvent event){
+            __atomic_fetch_add(field(storage<Class>(), event), 1, __ATOMIC_RELAXED);
+        }
+
+        template<typename Class>
+        static void allocated(size_t bytes){
+            __atomic_fetch_add(&storage<Class>().bytes, bytes, __ATOMIC_RELAXED);
+        }
+
+        // ? copy of the counters of Class, each one read atomically
+        template<typename Class>
+        static LifecycleCounters counters(){
+            LifecycleCounters &counters = storage<Class>();
+            LifecycleCounters copy;
+
+            copy.defaultConstructed = __atomic_load_n(&counters.defaultConstructed, __ATOMIC_RELAXED);
+            copy.constructed = __atomic_load_n(&counters.constructed, __ATOMIC_RELAXED);
+            copy.copyConstructed = __atomic_load_n(&counters.copyConstructed, __ATOMIC_RELAXED);
+            copy.copyAssigned = __atomic_load_n(&counters.copyAssigned, __ATOMIC_RELAXED);
+            copy.moveConstructed = __atomic_load_n(&counters.moveConstructed, __ATOMIC_RELAXED);
+            copy.moveAssigned = __atomic_load_n(&counters.moveAssigned, __ATOMIC_RELAXED);
+            copy.destroyed = __atomic_load_n(&counters.destroyed, __ATOMIC_RELAXED);
+            copy.bytes = __atomic_load_n(&counters.bytes, __ATOMIC_RELAXED);
+            return copy;
+        }
+
+        template<typename Class>
+        static void reset(){
+            LifecycleCounters &counters = storage<Class>();
+
+            for (int event = DefaultConstructed; event <= Destroyed; event++){
+                __atomic_store_n(field(counters, static_cast<LifecycleEvent>(event)), 0, __ATOMIC_RELAXED);
+            }
+            __atomic_store_n(&counters.bytes, 0, __ATOMIC_RELAXED);
+        }
+};
+
+// * Build switch
+// ? the policy of the classes that don't get one as a template parameter,
+// ? make LOG=NoLog or make LOG=CountingLog picks another one (after a make fclean)
+#ifndef LIFECYCLE_POLICY
+# define LIFECYCLE_POLICY CoutLog
+#endif
+
+typedef LIFECYCLE_POLICY DefaultLog;
+
+#endif
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FindEngine.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:02:09 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:05:13 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "FindEngine.hpp"
+#include "../common/CpuFeatures.hpp"
+#include <algorithm>
+
+// * Scalar search
+const int *findScalar(const int *first, const int *last, int num){
+    return std::find(first, last, num);
+}
+
+size_t countScalar(const int *first, const int *last, int num){
+    return std::count(first, last, num);
+}
+
+#if CPU_X86
+// * Vectorized search
+// ? compare a block with num, movemask gives one bit per byte that matched,
+// ? the lowest bit set is the first match and its index / 4 is the int that matched
+__attribute__((target("sse2")))
+static const int *findSse2(const int *first, const int *last, int num){
+    size_t size = last - first;
+    size_t i = 0;
+    const __m128i needle = _mm_set1_epi32(num);
+
+    for (; i + 4 <= size; i += 4){
+        __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(current, needle));
+        if (mask){
+            return first + i + __builtin_ctz(mask) / 4;
+        }
+    }
+    return findScalar(first + i, last, num);
+}
+
+// ? 4 blocks of 8 ints per loop, the compares of the blocks don't wait for each other
+// ? and only one branch is taken for 32 ints, the block that matched is looked for after
+__attribute__((target("avx2")))
+static const int *findAvx2(const int *first, const int *last, int num){
+    size_t size = last - first;
+    size_t i = 0;
+    const __m256i needle = _mm256_set1_epi32(num);
+
+    for (; i + 32 <= size; i += 32){
+        const __m256i *block = reinterpret_cast<const __m256i *>(first + i);
+        __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256(block), needle);
+        __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 1), needle);
+        __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 2), needle);
+        __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256(block + 3), needle);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (!_mm256_testz_si256(any, any)){
+            break;
+        }
+    }
+    for (; i + 8 <= size; i += 8){
+        __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i));
+        unsigned int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi32(current, needle));
+        if (mask){
+            return first + i + __builtin_ctz(mask) / 4;
+        }
+    }
+    return findScalar(first + i, last, num);
+}
+
+// * Vectorized count
+// ? a lane that matched is -1, subtracting it adds one to the count of the lane
+// ? the lanes are 32-bit, they are added to the total before they can overflow
+# define COUNT_FLUSH (1u << 30)
+
+__attribute__((target("sse2")))
+static size_t countSse2(const int *first, const int *last, int num){
+    size_t size = last - first;
+    size_t i = 0;
+    size_t count = 0;
+    const __m128i needle = _mm_set1_epi32(num);
+
+    while (i + 4 <= size){
+        size_t end = std::min(size - (size - i) % 4, i + static_cast<size_t>(COUNT_FLUSH) * 4);
+        __m128i counts = _mm_setzero_si128();
+        for (; i < end; i += 4){
+            __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+            counts = _mm_sub_epi32(counts, _mm_cmpeq_epi32(current, needle));
+        }
+        unsigned int lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), counts);
+        count += static_cast<size_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+    }
+    return count + countScalar(first + i, last, num);
+}
+
+__attribute__((target("avx2")))
+static size_t countAvx2(const int *first, const int *last, int num){
+    size_t size = last - first;
+    size_t i = 0;
+    size_t count = 0;
+    const __m256i needle = _mm256_set1_epi32(num);
+
+    while (i + 8 <= size){
+        size_t end = std::min(size - (size - i) % 8, i + static_cast<size_t>(COUNT_FLUSH) * 8);
+        __m256i counts = _mm256_setzero_si256();
+        for (; i < end; i += 8){
+            __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i));
+            counts = _mm256_sub_epi32(counts, _mm256_cmpeq_epi32(current, needle));
+        }
+        unsigned int lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), counts);
+        for (int lane = 0; lane < 8; lane++){
+            count += lanes[lane];
+        }
+    }
+    return count + countScalar(first + i, last, num);
+}
+#endif
+
+// * Runtime dispatch
+// ? a search or a count is one call through the kernel of the widest compare the CPU has,
+// ? the pointer is looked up on the first call and kept for the next ones
+typedef const int *(*FindKernel)(const int *, const int *, int);
+typedef size_t (*CountKernel)(const int *, const int *, int);
+
+const int *findVector(const int *first, const int *last, int num){
+#if CPU_X86
+    static FindKernel kernel = pickKernel<FindKernel>(findAvx2, findSse2, findScalar);
+
+    return kernel(first, last, num);
+#else
+    return findScalar(first, last, num);
+#endif
+}
+
+size_t countVector(const int *first, const int *last, int num){
+#if CPU_X86
+    static CountKernel kernel = pickKernel<CountKernel>(countAvx2, countSse2, countScalar);
+
+    return kernel(first, last, num);
+#else
+    return countScalar(first, last, num);
+#endif
+}
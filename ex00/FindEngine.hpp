@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FindEngine.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:02:09 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:05:13 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FINDENGINE_HPP
+# define FINDENGINE_HPP
+
+// * Includes
+#include <cstddef>
+
+// * Search kernels for contiguous ints
+// ? both return the first element equal to num in [first, last), or last when there is none
+// ? findVector() uses AVX2 or SSE2 when the CPU has them, otherwise it's findScalar()
+const int *findScalar(const int *first, const int *last, int num);
+const int *findVector(const int *first, const int *last, int num);
+
+// ? both return how many elements of [first, last) are equal to num
+size_t countScalar(const int *first, const int *last, int num);
+size_t countVector(const int *first, const int *last, int num);
+
+#endif
@@ -0,0 +1,182 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FindIndex.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:08:28 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:07 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FINDINDEX_HPP
+# define FINDINDEX_HPP
+
+// * Includes
+#include <iostream>
+#include <vector>
+#include <new>
+#include <stdexcept>
+#include "easyfind.hpp"
+#include "../common/Lifecycle.hpp"
+
+// * Class With Orthodox Canonical Form
+// * Template Class
+// ? Index of a container built once, then find() answers like easyfind() in O(1) on average
+// ? it's an open addressing hash table (linear probing) from a value to the first element equal to it
+// ? the index doesn't see the container change: the caller calls invalidate() or rebuild() after a change,
+// ? or passes its own version counter to sync() which rebuilds only when the version moved
+// ? Log is the lifecycle logging policy (CoutLog, NoLog, CountingLog), see Lifecycle.hpp
+// ! the index keeps iterators of the container, a change that invalidates them needs a rebuild before find()
+template<typename T, typename Log = DefaultLog>
+class FindIndex {
+    // ! private
+    private:
+        const T *container;
+        bool valid;
+        unsigned long builtVersion;
+        size_t mask;
+        std::vector<int> keys;
+        std::vector<unsigned char> used;
+        std::vector<typename T::const_iterator> positions;
+
+        // * Helpers
+        // ? slot of num, or the empty slot where it would go
+        size_t slotOf(int num) const {
+            size_t slot = hashKey(num) & this->mask;
+
+            while (this->used[slot] && this->keys[slot] != num){
+                slot = (slot + 1) & this->mask;
+            }
+            return slot;
+        }
+
+        // ? twice as many slots as elements, so a probe stays short even when they are all different
+        // ? the key of an element is the element itself, or its first for a map, like for easyfind (see keyOf())
+        // ! an element that doesn't fit in an int can't be equal to an int, it isn't indexed
+        void build(){
+            size_t slots = 1;
+            while (slots < this->container->size() * 2){
+                slots <<= 1;
+            }
+            this->mask = slots - 1;
+            this->keys.assign(slots, 0);
+            this->used.assign(slots, 0);
+            this->positions.assign(slots, this->container->end());
+
+            for (typename T::const_iterator it = this->container->begin(); it != this->container->end(); ++it){
+                int key = static_cast<int>(keyOf(*it));
+                if (!(keyOf(*it) == key)){
+                    continue;
+                }
+                size_t slot = this->slotOf(key);
+                if (!this->used[slot]){
+                    this->used[slot] = 1;
+                    this->keys[slot] = key;
+                    this->positions[slot] = it;
+                }
+            }
+            this->valid = true;
+        }
+
+    // ! public
+    public:
+        // * Default constructor
+        FindIndex(): container(NULL), valid(false), builtVersion(0), mask(0){
+            Log::template event<FindIndex>("FindIndex", DefaultConstructed);
+        };
+
+        // * Parametrised constructor
+        FindIndex(const T &indexed, unsigned long version = 0): container(&indexed), valid(false), builtVersion(version), mask(0){
+            this->build();
+
+            Log::template event<FindIndex>("FindIndex", Constructed);
+        };
+
+        // * Copy constructor
+        // ? the copy indexes the same container
+        FindIndex(const FindIndex &other): container(NULL), valid(false), builtVersion(0), mask(0){
+            *this = other;
+
+            Log::template event<FindIndex>("FindIndex", CopyConstructed);
+        };
+
+        // * Copy assignment operator
+        FindIndex &operator=(const FindIndex &other){
+            if (this != &other){
+                this->container = other.container;
+                this->valid = other.valid;
+                this->builtVersion = other.builtVersion;
+                this->mask = other.mask;
+                this->keys = other.keys;
+                this->used = other.used;
+                this->positions = other.positions;
+            }
+
+            Log::template event<FindIndex>("FindIndex", CopyAssigned);
+
+            return *this;
+        };
+
+        // * Destructor
+        ~FindIndex(){
+            Log::template event<FindIndex>("FindIndex", Destroyed);
+        };
+
+        // * Methods
+        // ? build the index again from the current content of the container
+        void rebuild(){
+            if (this->container == NULL){
+                throw std::runtime_error("The index has no container");
+            }
+            this->build();
+        }
+
+        void rebuild(unsigned long version){
+            this->rebuild();
+            this->builtVersion = version;
+        }
+
+        // ? the next find() rebuilds the index first
+        void invalidate(){
+            this->valid = false;
+        }
+
+        // ? rebuild only when the container changed since the index was built (or invalidated)
+        void sync(unsigned long version){
+            if (!this->valid || version != this->builtVersion){
+                this->rebuild(version);
+            }
+        }
+
+        bool isValid() const {
+            return this->valid;
+        }
+
+        unsigned long version() const {
+            return this->builtVersion;
+        }
+
+        // ? same result as easyfind(container, num, std::nothrow): container.end() on a miss
+        typename T::const_iterator find(const int num, const std::nothrow_t &){
+            if (!this->valid){
+                this->rebuild();
+            }
+            size_t slot = this->slotOf(num);
+
+            return this->used[slot] ? this->positions[slot] : this->container->end();
+        }
+
+        // ? same result as easyfind(container, num)
+        typename T::const_iterator find(const int num){
+            typename T::const_iterator it = this->find(num, std::nothrow);
+
+            if (it == this->container->end()){
+                throw std::runtime_error("Value not found");
+            }
+
+            return it;
+        }
+};
+#endif
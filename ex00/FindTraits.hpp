@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FindTraits.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:01:17 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:02:51 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FINDTRAITS_HPP
+# define FINDTRAITS_HPP
+
+// * Includes
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201103L
+# include <array>
+#endif
+
+// * Tags: how easyfind searches a container
+// ? LinearLookup: std::find from begin() to end(), the only choice for vector, deque, list...
+// ? OrderedLookup: the container is a tree (set, map, multiset, multimap), lower_bound() is O(log n)
+// ! a tree matches by key_comp() equivalence (!comp(a, b) && !comp(b, a)), not by operator==: with the
+// ! default std::less it's the same as std::find, with a custom comparator (modulo, case folding...)
+// ! the element found can be one std::find would skip
+// ? HashedLookup: the container is a hash table (unordered_*), equal_range() is O(1) on average
+// ? ContiguousLookup: the ints are next to each other in memory, the vectorized kernel of FindEngine.hpp
+// ? SortedLookup: the caller promised the range is sorted, std::lower_bound when it's random access
+struct LinearLookup {};
+struct ContiguousLookup {};
+struct OrderedLookup {};
+struct HashedLookup {};
+struct SortedLookup {};
+
+// * Opt-in tag for easyfind(container, num, assumeSorted)
+// ! nothing checks that the container is really sorted, an unsorted one can miss a value it has
+struct AssumeSorted {};
+static const AssumeSorted assumeSorted = AssumeSorted();
+
+// * Detection of the typedefs that only some containers have
+// ? key_compare only exists in the ordered associative containers, hasher only in the hashed ones
+// ? test<T>(0) picks the first overload when the typedef exists, the sizes of the results tell which one
+template<typename T>
+struct HasKeyCompare {
+    template<typename U>
+    static char test(typename U::key_compare *);
+    template<typename U>
+    static long test(...);
+    enum { value = sizeof(test<T>(0)) == sizeof(char) };
+};
+
+template<typename T>
+struct HasHasher {
+    template<typename U>
+    static char test(typename U::hasher *);
+    template<typename U>
+    static long test(...);
+    enum { value = sizeof(test<T>(0)) == sizeof(char) };
+};
+
+// * Lookup tag of a container
+template<typename T, bool ordered = HasKeyCompare<T>::value, bool hashed = HasHasher<T>::value>
+struct LookupOf {
+    typedef LinearLookup type;
+};
+
+template<typename T, bool hashed>
+struct LookupOf<T, true, hashed> {
+    typedef OrderedLookup type;
+};
+
+template<typename T>
+struct LookupOf<T, false, true> {
+    typedef HashedLookup type;
+};
+
+// ? vector<int> and array<int, N> keep their ints in one block, whatever the allocator
+template<typename Allocator>
+struct LookupOf<std::vector<int, Allocator>, false, false> {
+    typedef ContiguousLookup type;
+};
+
+#if __cplusplus >= 201103L
+template<std::size_t N>
+struct LookupOf<std::array<int, N>, false, false> {
+    typedef ContiguousLookup type;
+};
+#endif
+
+// * Lookup tag when the caller passed assumeSorted
+// ? the associative containers keep their own lookup, it's already better than a binary search
+template<typename Tag>
+struct SortedLookupOf {
+    typedef Tag type;
+};
+
+template<>
+struct SortedLookupOf<LinearLookup> {
+    typedef SortedLookup type;
+};
+
+template<>
+struct SortedLookupOf<ContiguousLookup> {
+    typedef SortedLookup type;
+};
+
+// * Key of an element: the element itself for a set, the first member of the pair for a map
+template<typename K>
+const K &keyOf(const K &value){
+    return value;
+}
+
+template<typename K, typename V>
+const K &keyOf(const std::pair<const K, V> &value){
+    return value.first;
+}
+
+#endif
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ParallelFind.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:05:37 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:05:37 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLELFIND_HPP
+# define PARALLELFIND_HPP
+
+// * Includes
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <pthread.h>
+#include "FindEngine.hpp"
+
+// * Shorter searches stay on the calling thread
+// ? the vectorized kernel scans a few hundred thousand ints in the time a thread takes to start and join,
+// ? and a search that hits early never needs the other threads: they only pay off from 4 MB of ints
+# define PARALLEL_FIND_THRESHOLD (1 << 20)
+
+// * Elements given to a worker at a time
+# define PARALLEL_FIND_CHUNK (1 << 16)
+
+// * State shared by all the workers of one search
+// ? next: start of the next chunk to hand out, the chunks go out in order
+// ? best: smallest index where num was found so far, size when it wasn't found
+// ! next and best are only touched with the __atomic builtins
+template<typename Iterator>
+struct FindShared {
+    Iterator first;
+    size_t size;
+    int num;
+    size_t next;
+    size_t best;
+};
+
+// * Search of one chunk, vectorized for contiguous ints
+template<typename Iterator>
+Iterator findChunk(Iterator first, Iterator last, int num){
+    return std::find(first, last, num);
+}
+
+inline const int *findChunk(const int *first, const int *last, int num){
+    return findVector(first, last, num);
+}
+
+// * Thread routine
+// ? a worker takes chunks until there are none left or the next one starts after the best match,
+// ? nothing after the best match can be the first one
+// ? every chunk before the best match was handed out before it and is searched to the end,
+// ? so the smallest index published is the first match, the same one as std::find
+template<typename Iterator>
+void *findWorker(void *arg){
+    FindShared<Iterator> *shared = static_cast<FindShared<Iterator> *>(arg);
+
+    for (;;){
+        size_t start = __atomic_fetch_add(&shared->next, PARALLEL_FIND_CHUNK, __ATOMIC_RELAXED);
+        if (start >= shared->size || start >= __atomic_load_n(&shared->best, __ATOMIC_RELAXED)){
+            break;
+        }
+
+        size_t end = std::min(start + PARALLEL_FIND_CHUNK, shared->size);
+        Iterator hit = findChunk(shared->first + start, shared->first + end, shared->num);
+        if (hit != shared->first + end){
+            size_t index = hit - shared->first;
+            size_t best = __atomic_load_n(&shared->best, __ATOMIC_RELAXED);
+            while (index < best && !__atomic_compare_exchange_n(&shared->best, &best, index, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+            }
+            // ? the chunks this worker would take next are all after this match
+            break;
+        }
+    }
+    return NULL;
+}
+
+// * Functions
+// ? first element equal to num in [first, last), or last, searched by `threads` threads
+// ? the calling thread is one of the workers, threads - 1 are created
+// ! if a thread can't be created the others (at least the calling one) do its share
+template<typename Iterator>
+Iterator parallelFind(Iterator first, Iterator last, int num, unsigned int threads){
+    FindShared<Iterator> shared;
+    shared.first = first;
+    shared.size = last - first;
+    shared.num = num;
+    shared.next = 0;
+    shared.best = shared.size;
+
+    if (threads <= 1 || shared.size < PARALLEL_FIND_THRESHOLD){
+        return findChunk(first, last, num);
+    }
+    threads = std::min(static_cast<size_t>(threads), shared.size / PARALLEL_FIND_CHUNK);
+
+    std::vector<pthread_t> ids(threads - 1);
+    std::vector<bool> started(ids.size(), false);
+    for (size_t i = 0; i < ids.size(); i++){
+        started[i] = pthread_create(&ids[i], NULL, findWorker<Iterator>, &shared) == 0;
+    }
+    findWorker<Iterator>(&shared);
+    for (size_t i = 0; i < ids.size(); i++){
+        if (started[i]){
+            pthread_join(ids[i], NULL);
+        }
+    }
+
+    return first + shared.best;
+}
+
+#endif
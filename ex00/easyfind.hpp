@@ -6,7 +6,7 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:00:47 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/07 18:46:46 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 19:07:58 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,14 +16,323 @@
 // * Includes
 #include <iostream>
 #include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <new>
+#include <cstddef>
+#include <vector>
+#include "FindTraits.hpp"
+#include "FindEngine.hpp"
+#include "ParallelFind.hpp"
+
+// * From this many keys a batch scans a sequence once instead of once per key
+# define BATCH_SCAN_THRESHOLD 32
+
+// * Lookups
+// ? every lookup returns the first element equal to num in the order of the container, like std::find,
+// ? or container.end() when there is none
+template<typename T>
+typename T::const_iterator findIn(const T &container, const int num, LinearLookup){
+    return std::find(container.begin(), container.end(), num);
+}
+
+// ? the position found in the block is turned back into an iterator of the container
+template<typename T>
+typename T::const_iterator findIn(const T &container, const int num, ContiguousLookup){
+    if (container.empty()){
+        return container.end();
+    }
+    const int *first = &container[0];
+    const int *hit = findVector(first, first + container.size(), num);
+
+    return container.begin() + (hit - first);
+}
+
+// ? lower_bound() and not find(): in a multiset or a multimap find() can return any of the equal elements
+// ! "equal" is the equivalence of key_comp(), the same as operator== only with the default comparator
+template<typename T>
+typename T::const_iterator findIn(const T &container, const int num, OrderedLookup){
+    typename T::const_iterator it = container.lower_bound(num);
+
+    if (it != container.end() && container.key_comp()(num, keyOf(*it))){
+        return container.end();
+    }
+    return it;
+}
+
+// ? the equal elements of a hash table are next to each other, equal_range() starts at the first of them
+template<typename T>
+typename T::const_iterator findIn(const T &container, const int num, HashedLookup){
+    std::pair<typename T::const_iterator, typename T::const_iterator> range = container.equal_range(num);
+
+    if (range.first == range.second){
+        return container.end();
+    }
+    return range.first;
+}
+
+// ? a binary search only pays when the iterators can jump, a list is still scanned
+template<typename Iterator>
+Iterator findSorted(Iterator first, Iterator last, const int num, std::random_access_iterator_tag){
+    Iterator it = std::lower_bound(first, last, num);
+
+    if (it != last && num < *it){
+        return last;
+    }
+    return it;
+}
+
+template<typename Iterator>
+Iterator findSorted(Iterator first, Iterator last, const int num, std::input_iterator_tag){
+    return std::find(first, last, num);
+}
+
+template<typename T>
+typename T::const_iterator findIn(const T &container, const int num, SortedLookup){
+    typedef typename T::const_iterator iterator;
+
+    return findSorted(container.begin(), container.end(), num, typename std::iterator_traits<iterator>::iterator_category());
+}
+
+// * Parallel lookups
+// ? the sequences that can jump to any index are split between the threads (see ParallelFind.hpp),
+// ? the others keep their normal lookup
+template<typename T, typename Tag>
+typename T::const_iterator parallelFindIn(const T &container, const int num, unsigned int, Tag tag){
+    return findIn(container, num, tag);
+}
+
+template<typename T>
+typename T::const_iterator parallelFindRange(const T &container, const int num, unsigned int threads, std::random_access_iterator_tag){
+    return parallelFind(container.begin(), container.end(), num, threads);
+}
+
+template<typename T>
+typename T::const_iterator parallelFindRange(const T &container, const int num, unsigned int, std::input_iterator_tag){
+    return findIn(container, num, LinearLookup());
+}
+
+template<typename T>
+typename T::const_iterator parallelFindIn(const T &container, const int num, unsigned int threads, LinearLookup){
+    typedef typename T::const_iterator iterator;
+
+    return parallelFindRange(container, num, threads, typename std::iterator_traits<iterator>::iterator_category());
+}
+
+template<typename T>
+typename T::const_iterator parallelFindIn(const T &container, const int num, unsigned int threads, ContiguousLookup){
+    if (container.empty()){
+        return container.end();
+    }
+    const int *first = &container[0];
+    const int *hit = parallelFind(first, first + container.size(), num, threads);
+
+    return container.begin() + (hit - first);
+}
+
+// * Every match
+// ? findAllIn() appends every element equal to num to matches, in the order of the container
+// ? countIn() only counts them, it doesn't allocate
+template<typename T>
+void findAllIn(const T &container, const int num, std::vector<typename T::const_iterator> &matches, LinearLookup){
+    for (typename T::const_iterator it = container.begin(); it != container.end(); ++it){
+        if (*it == num){
+            matches.push_back(it);
+        }
+    }
+}
+
+template<typename T>
+void findAllIn(const T &container, const int num, std::vector<typename T::const_iterator> &matches, ContiguousLookup){
+    if (container.empty()){
+        return;
+    }
+    const int *first = &container[0];
+    const int *last = first + container.size();
+    for (const int *hit = findVector(first, last, num); hit != last; hit = findVector(hit + 1, last, num)){
+        matches.push_back(container.begin() + (hit - first));
+    }
+}
+
+// ? in a tree or a hash table the equal elements are next to each other
+template<typename T>
+void findAllEqual(const T &container, const int num, std::vector<typename T::const_iterator> &matches){
+    std::pair<typename T::const_iterator, typename T::const_iterator> range = container.equal_range(num);
+
+    for (typename T::const_iterator it = range.first; it != range.second; ++it){
+        matches.push_back(it);
+    }
+}
+
+template<typename T>
+void findAllIn(const T &container, const int num, std::vector<typename T::const_iterator> &matches, OrderedLookup){
+    findAllEqual(container, num, matches);
+}
+
+template<typename T>
+void findAllIn(const T &container, const int num, std::vector<typename T::const_iterator> &matches, HashedLookup){
+    findAllEqual(container, num, matches);
+}
+
+template<typename T>
+size_t countIn(const T &container, const int num, LinearLookup){
+    return std::count(container.begin(), container.end(), num);
+}
+
+template<typename T>
+size_t countIn(const T &container, const int num, ContiguousLookup){
+    if (container.empty()){
+        return 0;
+    }
+    return countVector(&container[0], &container[0] + container.size(), num);
+}
+
+template<typename T>
+size_t countIn(const T &container, const int num, OrderedLookup){
+    return container.count(num);
+}
+
+template<typename T>
+size_t countIn(const T &container, const int num, HashedLookup){
+    return container.count(num);
+}
+
+// * Batch lookups
+// ? results[i] is the first element equal to keys[i], or container.end(), exactly like findIn()
+
+// ? multiplicative hash, the high bits of the product are the best mixed so they are folded down
+inline size_t hashKey(int key){
+    unsigned long long product = static_cast<unsigned long long>(static_cast<unsigned int>(key)) * 0x9E3779B97F4A7C15ULL;
+
+    return static_cast<size_t>(product ^ (product >> 32));
+}
+
+// ? one scan for all the keys: they go in a small open addressing hash table (linear probing),
+// ? every element costs one hash and usually one compare, the first element that matches a key is kept
+// ? and the scan stops when every key is found
+// ! an element that doesn't fit in an int hashes to the wrong slot but never compares equal, so it's never kept
+template<typename T>
+void findBatchScan(const T &container, const std::vector<int> &keys, std::vector<typename T::const_iterator> &results){
+    const size_t empty = static_cast<size_t>(-1);
+    size_t mask = 1;
+    while (mask < keys.size() * 2){
+        mask <<= 1;
+    }
+    mask--;
+
+    // * slot -> index of the first query with this key, duplicated keys share the slot
+    std::vector<size_t> table(mask + 1, empty);
+    std::vector<size_t> slotOf(keys.size());
+    size_t missing = 0;
+    for (size_t i = 0; i < keys.size(); i++){
+        size_t slot = hashKey(keys[i]) & mask;
+        while (table[slot] != empty && keys[table[slot]] != keys[i]){
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot] == empty){
+            table[slot] = i;
+            missing++;
+        }
+        slotOf[i] = slot;
+    }
+
+    std::vector<typename T::const_iterator> firsts(mask + 1, container.end());
+    for (typename T::const_iterator it = container.begin(); it != container.end() && missing; ++it){
+        size_t slot = hashKey(static_cast<int>(*it)) & mask;
+        while (table[slot] != empty && !(keys[table[slot]] == *it)){
+            slot = (slot + 1) & mask;
+        }
+        if (table[slot] != empty && firsts[slot] == container.end()){
+            firsts[slot] = it;
+            missing--;
+        }
+    }
+
+    for (size_t i = 0; i < keys.size(); i++){
+        results[i] = firsts[slotOf[i]];
+    }
+}
+
+// ? the associative containers already answer one key in O(log n) or O(1)
+template<typename T, typename Tag>
+void findBatchIn(const T &container, const std::vector<int> &keys, std::vector<typename T::const_iterator> &results, Tag tag){
+    for (size_t i = 0; i < keys.size(); i++){
+        results[i] = findIn(container, keys[i], tag);
+    }
+}
+
+// ? a few keys are cheaper with one (vectorized) scan each than with a hash of every element
+template<typename T, typename Tag>
+void findBatchSequence(const T &container, const std::vector<int> &keys, std::vector<typename T::const_iterator> &results, Tag tag){
+    if (keys.size() < BATCH_SCAN_THRESHOLD){
+        for (size_t i = 0; i < keys.size(); i++){
+            results[i] = findIn(container, keys[i], tag);
+        }
+        return;
+    }
+    findBatchScan(container, keys, results);
+}
+
+template<typename T>
+void findBatchIn(const T &container, const std::vector<int> &keys, std::vector<typename T::const_iterator> &results, LinearLookup tag){
+    findBatchSequence(container, keys, results, tag);
+}
+
+template<typename T>
+void findBatchIn(const T &container, const std::vector<int> &keys, std::vector<typename T::const_iterator> &results, ContiguousLookup tag){
+    findBatchSequence(container, keys, results, tag);
+}
 
 // * Functions
+// ? the lookup is picked at compile time from the type of the container (see FindTraits.hpp)
+// ? easyfind(container, num, std::nothrow) returns container.end() on a miss, it doesn't throw nor allocate
+// ! in a tree with a custom comparator the match is by key_comp() equivalence (see FindTraits.hpp)
+template<typename T>
+typename T::const_iterator easyfind(const T &container, const int num, const std::nothrow_t &){
+    return findIn(container, num, typename LookupOf<T>::type());
+}
+
 template<typename T>
 typename T::const_iterator easyfind(const T &container, const int num){
     // * we use const_iterator because we get const container and we don't need to edit the iterator just read it
     typename T::const_iterator it;
     
-    it = std::find(container.begin(), container.end(), num);
+    it = easyfind(container, num, std::nothrow);
+    if (it == container.end()){
+        throw std::runtime_error("Value not found");
+    }
+
+    return it;
+}
+
+// ? a C array is contiguous too, the result is a pointer in it (array + N on a miss with std::nothrow)
+template<std::size_t N>
+const int *easyfind(const int (&array)[N], const int num, const std::nothrow_t &){
+    return findVector(array, array + N, num);
+}
+
+template<std::size_t N>
+const int *easyfind(const int (&array)[N], const int num){
+    const int *it = easyfind(array, num, std::nothrow);
+
+    if (it == array + N){
+        throw std::runtime_error("Value not found");
+    }
+
+    return it;
+}
+
+// ? same as easyfind(container, num) but the caller promises the container is sorted
+template<typename T>
+typename T::const_iterator easyfind(const T &container, const int num, AssumeSorted, const std::nothrow_t &){
+    return findIn(container, num, typename SortedLookupOf<typename LookupOf<T>::type>::type());
+}
+
+template<typename T>
+typename T::const_iterator easyfind(const T &container, const int num, AssumeSorted){
+    typename T::const_iterator it;
+
+    it = easyfind(container, num, assumeSorted, std::nothrow);
     if (it == container.end()){
         throw std::runtime_error("Value not found");
     }
@@ -31,4 +340,51 @@ typename T::const_iterator easyfind(const T &container, const int num){
     return it;
 }
 
+// ? same result as easyfind(container, num), a big vector or deque is searched by `threads` threads
+// ? and the threads stop as soon as the first match is known
+template<typename T>
+typename T::const_iterator easyfind_parallel(const T &container, const int num, unsigned int threads, const std::nothrow_t &){
+    return parallelFindIn(container, num, threads, typename LookupOf<T>::type());
+}
+
+template<typename T>
+typename T::const_iterator easyfind_parallel(const T &container, const int num, unsigned int threads){
+    typename T::const_iterator it;
+
+    it = easyfind_parallel(container, num, threads, std::nothrow);
+    if (it == container.end()){
+        throw std::runtime_error("Value not found");
+    }
+
+    return it;
+}
+
+// ? every element equal to num in one scan, in the order of the container, empty when there is none
+template<typename T>
+std::vector<typename T::const_iterator> easyfind_all(const T &container, const int num){
+    std::vector<typename T::const_iterator> matches;
+
+    findAllIn(container, num, matches, typename LookupOf<T>::type());
+
+    return matches;
+}
+
+// ? how many elements are equal to num, without keeping their positions
+template<typename T>
+size_t easyfind_count(const T &container, const int num){
+    return countIn(container, num, typename LookupOf<T>::type());
+}
+
+// ? look for every key of [first, last) at once, the result of a key is at the same index
+// ! a key that isn't in the container doesn't throw, its result is container.end()
+template<typename T, typename KeyIterator>
+std::vector<typename T::const_iterator> easyfind_batch(const T &container, KeyIterator first, KeyIterator last){
+    std::vector<int> keys(first, last);
+    std::vector<typename T::const_iterator> results(keys.size(), container.end());
+
+    findBatchIn(container, keys, results, typename LookupOf<T>::type());
+
+    return results;
+}
+
 #endif
\ No newline at end of file
@@ -6,14 +6,20 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:00:08 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/05 17:29:55 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 20:06:16 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "easyfind.hpp"
+#include "FindIndex.hpp"
 #include <vector>
 #include <queue>
 #include <list>
+#include <set>
+#include <map>
+#if __cplusplus >= 201103L
+# include <unordered_set>
+#endif
 
 int main(){
     try {
@@ -43,6 +49,101 @@ int main(){
         
         std::list<int>::const_iterator it3 = easyfind(c, 777);
         std::cout << *it3 << std::endl;
+
+        // * Set: uses the tree, not a linear scan
+        std::set<int>d;
+        for (int i = 0; i < 1000; i++){
+            d.insert(i);
+        }
+
+        std::set<int>::const_iterator it4 = easyfind(d, 666);
+        std::cout << *it4 << std::endl;
+
+        // * Map: the value is looked up in the keys
+        std::map<int, int>e;
+        for (int i = 0; i < 1000; i++){
+            e[i] = i * 2;
+        }
+
+        std::map<int, int>::const_iterator it5 = easyfind(e, 555);
+        std::cout << it5->first << " " << it5->second << std::endl;
+
+        // * Multiset: the first of the equal elements, like std::find
+        std::multiset<int>f;
+        for (int i = 0; i < 1000; i++){
+            f.insert(i / 2);
+        }
+
+        std::multiset<int>::const_iterator it6 = easyfind(f, 444);
+        std::cout << *it6 << " " << std::distance(f.begin(), it6) << std::endl; // 444 888
+
+        // * Sorted vector: binary search when the caller says it's sorted
+        std::vector<int>::const_iterator it7 = easyfind(a, 333, assumeSorted);
+        std::cout << *it7 << std::endl;
+
+        // * Array: same vectorized search as the vector
+        int h[] = {42, 13, 7, 13};
+        const int *it9 = easyfind(h, 13);
+        std::cout << *it9 << " " << it9 - h << std::endl; // 13 1
+
+        // * Batch: all the keys in one call, a missing key gives end() instead of throwing
+        int keys[] = {10, 500, 1000, 999};
+        std::vector<std::vector<int>::const_iterator> found = easyfind_batch(a, keys, keys + 4);
+        for (size_t i = 0; i < found.size(); i++){
+            if (found[i] == a.end()){
+                std::cout << keys[i] << " missing" << std::endl;
+            } else {
+                std::cout << *found[i] << std::endl;
+            }
+        }
+
+        // * Nothrow: a miss is end(), no exception
+        if (easyfind(d, 1000, std::nothrow) == d.end()){
+            std::cout << "1000 missing" << std::endl;
+        }
+
+        // * Every match in one scan, and only the count
+        std::vector<int> digits;
+        for (int j = 0; j < 100; j++){
+            digits.push_back(j % 10);
+        }
+        std::vector<std::vector<int>::const_iterator> matches = easyfind_all(digits, 3);
+        std::cout << matches.size() << " " << matches[0] - digits.begin() << " " << matches[9] - digits.begin() << std::endl; // 10 3 93
+        std::cout << easyfind_count(digits, 3) << " " << easyfind_count(f, 444) << std::endl; // 10 2
+
+        // * Parallel: big containers are split between the threads, the result is still the first match
+        std::vector<int> k(4000000, 0);
+        k[3000000] = 42;
+        k[3500000] = 42;
+        std::vector<int>::const_iterator it10 = easyfind_parallel(k, 42, 4);
+        std::cout << *it10 << " " << it10 - k.begin() << std::endl; // 42 3000000
+
+        // * Index: built once, then every lookup is O(1) until the container changes
+        unsigned long version = 0;
+        FindIndex<std::vector<int> > index(a, version);
+        std::cout << *index.find(999) << std::endl;
+        a.push_back(1000);
+        version++;
+        index.sync(version);
+        std::cout << *index.find(1000) << std::endl;
+
+        // ? over a map the keys are indexed, like easyfind searches them
+        FindIndex<std::map<int, int> > mapIndex(e);
+        std::cout << mapIndex.find(555)->first << " " << mapIndex.find(555)->second << std::endl; // 555 1110
+
+#if __cplusplus >= 201103L
+        // * Unordered set: uses the hash table
+        std::unordered_set<int>g;
+        for (int i = 0; i < 1000; i++){
+            g.insert(i);
+        }
+
+        std::unordered_set<int>::const_iterator it8 = easyfind(g, 222);
+        std::cout << *it8 << std::endl;
+#endif
+
+        // ! missing value
+        easyfind(d, 1000);
         
     } catch (const std::exception &e){
         std::cout << e.what() << std::endl;
@@ -0,0 +1,189 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ApproxSpan.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:53:47 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:10:32 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ApproxSpan.hpp"
+
+// * Default constructor
+template<typename T>
+ApproxSpan<T>::ApproxSpan(): count(0), minValue(0), maxValue(0), dirty(true), shortest(0){
+    this->setup(BucketBits(APPROX_BUCKET_BITS));
+
+    DefaultLog::event<ApproxSpan>("ApproxSpan", DefaultConstructed);
+}
+
+// * Parametrised constructor
+template<typename T>
+ApproxSpan<T>::ApproxSpan(BucketBits bucketBits): count(0), minValue(0), maxValue(0), dirty(true), shortest(0){
+    this->setup(bucketBits);
+
+    DefaultLog::event<ApproxSpan>("ApproxSpan", Constructed);
+}
+
+// * Copy constructor
+template<typename T>
+ApproxSpan<T>::ApproxSpan(const ApproxSpan &other){
+    // ! call copy assignment operator
+    *this = other;
+
+    DefaultLog::event<ApproxSpan>("ApproxSpan", CopyConstructed);
+}
+
+// * Copy assignment operator
+template<typename T>
+ApproxSpan<T> &ApproxSpan<T>::operator=(const ApproxSpan &other){
+    if (this != &other){
+        this->bucketBits = other.bucketBits;
+        this->shift = other.shift;
+        this->buckets = other.buckets;
+        this->count = other.count;
+        this->minValue = other.minValue;
+        this->maxValue = other.maxValue;
+        this->dirty = other.dirty;
+        this->shortest = other.shortest;
+    }
+
+    DefaultLog::event<ApproxSpan>("ApproxSpan", CopyAssigned);
+
+    return *this;
+}
+
+// * Destructor
+template<typename T>
+ApproxSpan<T>::~ApproxSpan(){
+    DefaultLog::event<ApproxSpan>("ApproxSpan", Destroyed);
+}
+
+// * Helpers
+// ? bucketBits is capped by the size of T, over APPROX_MAX_BUCKET_BITS it's rejected
+template<typename T>
+void ApproxSpan<T>::setup(BucketBits bucketBits){
+    const unsigned int keyBits = sizeof(key_type) * 8;
+
+    if (bucketBits.bits > APPROX_MAX_BUCKET_BITS){
+        throw std::runtime_error("Too many bucket bits");
+    }
+    this->bucketBits = std::min(bucketBits.bits, keyBits);
+    this->shift = keyBits - this->bucketBits;
+
+    Bucket empty = Bucket();
+    this->buckets.assign(static_cast<size_t>(1) << this->bucketBits, empty);
+}
+
+// * Methods
+template<typename T>
+void ApproxSpan<T>::addNumber(T number){
+    // ! a shift as wide as the key is undefined, it only happens when T has a single bucket
+    size_t index = this->shift >= sizeof(key_type) * 8 ? 0 : SpanTraits<T>::key(number) >> this->shift;
+    Bucket &bucket = this->buckets[index];
+
+    if (!bucket.occupied){
+        bucket.minValue = number;
+        bucket.maxValue = number;
+        bucket.occupied = true;
+    } else {
+        // ? the new number is at most this far from a number of the bucket, so the smallest gap can't be bigger
+        result_type gap;
+        if (number < bucket.minValue){
+            gap = SpanTraits<T>::distance(number, bucket.minValue);
+            bucket.minValue = number;
+        } else if (number > bucket.maxValue){
+            gap = SpanTraits<T>::distance(bucket.maxValue, number);
+            bucket.maxValue = number;
+        } else {
+            gap = std::min(SpanTraits<T>::distance(bucket.minValue, number),
+                SpanTraits<T>::distance(number, bucket.maxValue));
+        }
+        if (!bucket.hasBound || gap < bucket.bound){
+            bucket.bound = gap;
+            bucket.hasBound = true;
+        }
+    }
+
+    // * the smallest and biggest numbers of the whole stream are exact
+    if (this->count == 0 || number < this->minValue){
+        this->minValue = number;
+    }
+    if (this->count == 0 || number > this->maxValue){
+        this->maxValue = number;
+    }
+    this->count++;
+    this->dirty = true;
+}
+
+// ? one pass over the buckets: exact gaps between neighbour buckets, bounds inside them
+template<typename T>
+typename ApproxSpan<T>::result_type ApproxSpan<T>::shortestSpan(){
+    if (this->count == 0 || this->count == 1){
+        throw std::runtime_error("Add more numbers");
+    }
+
+    if (!this->dirty){
+        return this->shortest;
+    }
+
+    bool found = false;
+    result_type result = 0;
+    const Bucket *previous = NULL;
+    for (size_t i = 0; i < this->buckets.size(); i++){
+        const Bucket &bucket = this->buckets[i];
+        if (!bucket.occupied){
+            continue;
+        }
+        if (previous != NULL){
+            result_type gap = SpanTraits<T>::distance(previous->maxValue, bucket.minValue);
+            if (!found || gap < result){
+                result = gap;
+                found = true;
+            }
+        }
+        if (bucket.hasBound && (!found || bucket.bound < result)){
+            result = bucket.bound;
+            found = true;
+        }
+        previous = &bucket;
+    }
+
+    this->shortest = result;
+    this->dirty = false;
+
+    return result;
+}
+
+template<typename T>
+typename ApproxSpan<T>::result_type ApproxSpan<T>::longestSpan(){
+    if (this->count == 0 || this->count == 1){
+        throw std::runtime_error("Add more numbers");
+    }
+
+    return SpanTraits<T>::distance(this->minValue, this->maxValue);
+}
+
+template<typename T>
+typename ApproxSpan<T>::result_type ApproxSpan<T>::maxError() const {
+    if (this->shift >= sizeof(key_type) * 8){
+        return static_cast<key_type>(-1);
+    }
+    return static_cast<key_type>((static_cast<key_type>(1) << this->shift) - 1);
+}
+
+// * Explicit instantiations for the integer types of SpanTraits.hpp
+template class ApproxSpan<char>;
+template class ApproxSpan<signed char>;
+template class ApproxSpan<unsigned char>;
+template class ApproxSpan<short>;
+template class ApproxSpan<unsigned short>;
+template class ApproxSpan<int>;
+template class ApproxSpan<unsigned int>;
+template class ApproxSpan<long>;
+template class ApproxSpan<unsigned long>;
+template class ApproxSpan<long long>;
+template class ApproxSpan<unsigned long long>;
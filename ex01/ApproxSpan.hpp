@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ApproxSpan.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:53:47 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:13:13 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef APPROXSPAN_HPP
+# define APPROXSPAN_HPP
+
+// * Includes
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include "SpanTraits.hpp"
+#include "../common/Lifecycle.hpp"
+
+// * Default and biggest number of bits used to pick a bucket
+// ? a bucket is 24 to 32 bytes: 2^16 buckets take at most 2 MB, the maximum 2^20 at most 32 MB
+# define APPROX_BUCKET_BITS 16
+# define APPROX_MAX_BUCKET_BITS 20
+
+// * Number of bucket bits, its own type so it can't be mistaken for the capacity of Span(size)
+// ? ApproxSpan<int>(BucketBits(8)) has 2^8 buckets, ApproxSpan<int>(8) doesn't compile
+struct BucketBits {
+    unsigned int bits;
+
+    explicit BucketBits(unsigned int bits): bits(bits){
+    }
+};
+
+// * Class With Orthodox Canonical Form
+// * Template Class
+// ? Span of an unbounded stream of integers in a fixed amount of memory
+// ? the range of T is cut in 2^bucketBits buckets of the same width, a bucket only keeps its smallest
+// ? and biggest number and an upper bound of the smallest gap inside it
+// ? longestSpan() is exact: the smallest and the biggest numbers of the stream are kept
+// ? shortestSpan() is approximate: the gaps between two buckets are exact, the gaps inside a bucket
+// ? are bounded, so with `exact` the real shortest span:  exact <= shortestSpan() <= exact + maxError()
+// ? where maxError() is the width of a bucket minus one (0 when every number has its own bucket)
+// ? memory is 2^bucketBits buckets whatever the length of the stream
+template<typename T>
+class ApproxSpan {
+    // ! public
+    public:
+        typedef typename SpanTraits<T>::result_type result_type;
+        typedef typename SpanTraits<T>::key_type key_type;
+
+    // ! private
+    private:
+        // * What is left of the numbers of one bucket
+        struct Bucket {
+            T minValue;
+            T maxValue;
+            // ? smallest gap inside the bucket is <= bound, only valid when the bucket has 2 numbers or more
+            result_type bound;
+            bool occupied;
+            bool hasBound;
+        };
+
+        unsigned int bucketBits;
+        unsigned int shift;
+        std::vector<Bucket>buckets;
+        size_t count;
+        T minValue;
+        T maxValue;
+        // ? shortest is only valid while dirty is false
+        bool dirty;
+        result_type shortest;
+
+        // * Helpers
+        void setup(BucketBits bucketBits);
+
+    // ! public
+    public:
+        // * Default constructor
+        ApproxSpan();
+
+        // * Parametrised constructor
+        // ! 2^bucketBits buckets, not a capacity: more than APPROX_MAX_BUCKET_BITS bits throws
+        explicit ApproxSpan(BucketBits bucketBits);
+
+        // * Copy constructor
+        ApproxSpan(const ApproxSpan &other);
+
+        // * Copy assignment operator
+        ApproxSpan &operator=(const ApproxSpan &other);
+
+        // * Destructor
+        ~ApproxSpan();
+
+        // * Methods
+        void addNumber(T number);
+
+        template<typename Iterator>
+        void addNumbers(Iterator first, Iterator last){
+            for (; first != last; ++first){
+                this->addNumber(*first);
+            }
+        }
+
+        result_type shortestSpan();
+        result_type longestSpan();
+        result_type maxError() const;
+};
+#endif
@@ -0,0 +1,189 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ConcurrentSpan.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:50:38 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:08:37 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "ConcurrentSpan.hpp"
+
+// * Default constructor
+template<typename T>
+ConcurrentSpan<T>::ConcurrentSpan(): sizeOfvector(0), reserved(0), merged(0){
+    pthread_mutex_init(&this->lock, NULL);
+
+    DefaultLog::event<ConcurrentSpan>("ConcurrentSpan", DefaultConstructed);
+}
+
+// * Parametrised constructor
+template<typename T>
+ConcurrentSpan<T>::ConcurrentSpan(const unsigned int &size): sizeOfvector(size), slots(size), ready(size, 0),
+    reserved(0), merged(0), span(size){
+    pthread_mutex_init(&this->lock, NULL);
+
+    DefaultLog::event<ConcurrentSpan>("ConcurrentSpan", Constructed);
+}
+
+// * Copy constructor
+template<typename T>
+ConcurrentSpan<T>::ConcurrentSpan(const ConcurrentSpan &other): sizeOfvector(0), reserved(0), merged(0){
+    pthread_mutex_init(&this->lock, NULL);
+    // ! call copy assignment operator
+    *this = other;
+
+    DefaultLog::event<ConcurrentSpan>("ConcurrentSpan", CopyConstructed);
+}
+
+// * Copy assignment operator
+// ? copies what other has merged so far, after merging every ready slot
+// ! this must not be used by other threads while it is assigned
+template<typename T>
+ConcurrentSpan<T> &ConcurrentSpan<T>::operator=(const ConcurrentSpan &other){
+    if (this != &other){
+        ConcurrentSpan &source = const_cast<ConcurrentSpan &>(other);
+
+        pthread_mutex_lock(&source.lock);
+        source.merge();
+        this->sizeOfvector = source.sizeOfvector;
+        if (source.slots.empty()){
+            // ? every slot of other is merged and released, its span is the only copy of the numbers
+            this->slots.clear();
+            this->ready.clear();
+            this->reserved = source.sizeOfvector;
+            this->merged = source.sizeOfvector;
+            this->span = source.span;
+        } else {
+            this->slots.assign(source.slots.begin(), source.slots.begin() + source.merged);
+            this->slots.resize(source.sizeOfvector);
+            this->ready.assign(source.sizeOfvector, 0);
+            std::fill(this->ready.begin(), this->ready.begin() + source.merged, 1);
+            this->reserved = source.merged;
+            this->merged = 0;
+            // ? the copied slots are merged again into a new span on the next query
+            this->span = BasicSpan<T>(this->sizeOfvector);
+        }
+        pthread_mutex_unlock(&source.lock);
+    }
+
+    DefaultLog::event<ConcurrentSpan>("ConcurrentSpan", CopyAssigned);
+
+    return *this;
+}
+
+// * Destructor
+template<typename T>
+ConcurrentSpan<T>::~ConcurrentSpan(){
+    pthread_mutex_destroy(&this->lock);
+
+    DefaultLog::event<ConcurrentSpan>("ConcurrentSpan", Destroyed);
+}
+
+// * Helpers
+// ? claim `count` slots in a row, a batch that doesn't fit is rejected as a whole
+template<typename T>
+size_t ConcurrentSpan<T>::reserve(size_t count){
+    size_t slot = __atomic_load_n(&this->reserved, __ATOMIC_RELAXED);
+
+    do {
+        if (slot > this->sizeOfvector || count > this->sizeOfvector - slot){
+            throw std::runtime_error("The size is full");
+        }
+    } while (!__atomic_compare_exchange_n(&this->reserved, &slot, slot + count, true,
+        __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    return slot;
+}
+
+// ? move the ready slots that follow the merged ones into span, in one batch
+// ! the lock must be held
+template<typename T>
+void ConcurrentSpan<T>::merge(){
+    size_t bound = std::min(__atomic_load_n(&this->reserved, __ATOMIC_RELAXED),
+        static_cast<size_t>(this->sizeOfvector));
+    size_t end = this->merged;
+
+    while (end < bound && __atomic_load_n(&this->ready[end], __ATOMIC_ACQUIRE)){
+        end++;
+    }
+    if (end == this->merged){
+        return;
+    }
+
+    const T *first = &this->slots[0];
+    this->span.addNumbers(first + this->merged, first + end);
+    this->merged = end;
+
+    // ? the span is full: no slot can be reserved any more, the numbers now only live in span
+    if (this->merged == this->sizeOfvector){
+        std::vector<T>().swap(this->slots);
+        std::vector<char>().swap(this->ready);
+    }
+}
+
+// * Methods
+template<typename T>
+void ConcurrentSpan<T>::addNumber(T number){
+    // ? a single number doesn't need the compare and swap loop, a slot past the end is just never used
+    size_t slot = __atomic_fetch_add(&this->reserved, 1, __ATOMIC_RELAXED);
+    if (slot >= this->sizeOfvector){
+        throw std::runtime_error("The size is full");
+    }
+
+    this->slots[slot] = number;
+    __atomic_store_n(&this->ready[slot], 1, __ATOMIC_RELEASE);
+}
+
+template<typename T>
+typename ConcurrentSpan<T>::result_type ConcurrentSpan<T>::shortestSpan(){
+    pthread_mutex_lock(&this->lock);
+    try {
+        this->merge();
+        result_type result = this->span.shortestSpan();
+        pthread_mutex_unlock(&this->lock);
+        return result;
+    } catch (...){
+        pthread_mutex_unlock(&this->lock);
+        throw;
+    }
+}
+
+template<typename T>
+typename ConcurrentSpan<T>::result_type ConcurrentSpan<T>::longestSpan(){
+    pthread_mutex_lock(&this->lock);
+    try {
+        this->merge();
+        result_type result = this->span.longestSpan();
+        pthread_mutex_unlock(&this->lock);
+        return result;
+    } catch (...){
+        pthread_mutex_unlock(&this->lock);
+        throw;
+    }
+}
+
+template<typename T>
+void ConcurrentSpan<T>::setThreads(unsigned int threads){
+    pthread_mutex_lock(&this->lock);
+    this->span.setThreads(threads);
+    pthread_mutex_unlock(&this->lock);
+}
+
+// * Explicit instantiations for every type of SpanTraits.hpp
+template class ConcurrentSpan<char>;
+template class ConcurrentSpan<signed char>;
+template class ConcurrentSpan<unsigned char>;
+template class ConcurrentSpan<short>;
+template class ConcurrentSpan<unsigned short>;
+template class ConcurrentSpan<int>;
+template class ConcurrentSpan<unsigned int>;
+template class ConcurrentSpan<long>;
+template class ConcurrentSpan<unsigned long>;
+template class ConcurrentSpan<long long>;
+template class ConcurrentSpan<unsigned long long>;
+template class ConcurrentSpan<float>;
+template class ConcurrentSpan<double>;
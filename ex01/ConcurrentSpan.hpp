@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ConcurrentSpan.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:50:38 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:07 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENTSPAN_HPP
+# define CONCURRENTSPAN_HPP
+
+// * Includes
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <pthread.h>
+#include "Span.hpp"
+
+// * Class With Orthodox Canonical Form
+// * Template Class
+// ? Span that many threads can fill at the same time without a lock
+// ? addNumber() reserves a slot with one atomic add, writes the number and marks the slot ready,
+// ? the ready slots are merged in a BasicSpan only when shortestSpan() or longestSpan() is called
+// ? addNumbers() reserves the whole batch with one atomic operation, it is the path that scales with
+// ? the number of producers because they don't fight for the counter on every number
+// ! a query sees every number up to the first slot that is reserved but still being written
+// ! memory: until it is full every number is kept twice, in its slot and in span, both sized to the capacity
+// ! from the start: size * (2 * sizeof(T) + 1) bytes with the ready flags, plus the sort scratch of span
+// ! the merge that fills span releases the slots, from then on it costs as much as a Span
+template<typename T>
+class ConcurrentSpan {
+    // ! public
+    public:
+        typedef typename BasicSpan<T>::result_type result_type;
+
+    // ! private
+    private:
+        unsigned int sizeOfvector;
+        std::vector<T>slots;
+        std::vector<char>ready;
+        // ? next free slot, may go past sizeOfvector when producers race for the last ones
+        size_t reserved;
+        // ? slots [0, merged) are already in span, slots and ready are released once they all are
+        size_t merged;
+        BasicSpan<T>span;
+        // ? only the queries take the lock, the producers never do
+        pthread_mutex_t lock;
+
+        // * Helpers
+        size_t reserve(size_t count);
+        void merge();
+
+        // ? a single pass range can't be counted first: every number reserves its own slot
+        template<typename Iterator>
+        void addRange(Iterator first, Iterator last, std::input_iterator_tag){
+            for (; first != last; ++first){
+                this->addNumber(*first);
+            }
+        }
+
+        // ? a forward range is counted first and reserves all its slots at once
+        template<typename Iterator>
+        void addRange(Iterator first, Iterator last, std::forward_iterator_tag){
+            size_t count = std::distance(first, last);
+            if (count == 0){
+                return;
+            }
+
+            size_t slot = this->reserve(count);
+            std::copy(first, last, this->slots.begin() + slot);
+            for (size_t i = slot; i < slot + count; i++){
+                __atomic_store_n(&this->ready[i], 1, __ATOMIC_RELEASE);
+            }
+        }
+
+    // ! public
+    public:
+        // * Default constructor
+        ConcurrentSpan();
+
+        // * Parametrised constructor
+        ConcurrentSpan(const unsigned int &size);
+
+        // * Copy constructor
+        ConcurrentSpan(const ConcurrentSpan &other);
+
+        // * Copy assignment operator
+        ConcurrentSpan &operator=(const ConcurrentSpan &other);
+
+        // * Destructor
+        ~ConcurrentSpan();
+
+        // * Methods
+        void addNumber(T number);
+
+        // ? see addRange(), an input range (std::istream_iterator...) takes one slot per number
+        template<typename Iterator>
+        void addNumbers(Iterator first, Iterator last){
+            this->addRange(first, last, typename std::iterator_traits<Iterator>::iterator_category());
+        }
+
+        result_type shortestSpan();
+        result_type longestSpan();
+        void setThreads(unsigned int threads);
+};
+#endif
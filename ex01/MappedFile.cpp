@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MappedFile.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:56:55 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:05 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "MappedFile.hpp"
+#include <stdexcept>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// * Default constructor
+MappedFile::MappedFile(): mapping(NULL){
+}
+
+// * Parametrised constructor
+MappedFile::MappedFile(const std::string &path): mapping(NULL){
+    if (!this->map(path)){
+        throw std::runtime_error("Can't map " + path);
+    }
+}
+
+MappedFile::MappedFile(const std::string &path, const std::nothrow_t &): mapping(NULL){
+    this->map(path);
+}
+
+// * Copy constructor
+MappedFile::MappedFile(const MappedFile &other): mapping(NULL){
+    // ! call copy assignment operator
+    *this = other;
+}
+
+// * Copy assignment operator
+MappedFile &MappedFile::operator=(const MappedFile &other){
+    if (this != &other){
+        this->release();
+        this->mapping = other.mapping;
+        if (this->mapping != NULL){
+            __atomic_fetch_add(&this->mapping->references, 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    return *this;
+}
+
+// * Destructor
+MappedFile::~MappedFile(){
+    this->release();
+}
+
+// * Helpers
+// ? open, fstat and mmap the same descriptor, so the size is the size of what is mapped
+bool MappedFile::map(const std::string &path){
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1){
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1){
+        close(fd);
+        return false;
+    }
+
+    // ! an empty file can't be mapped, it is an open mapping of size 0
+    void *data = NULL;
+    if (info.st_size > 0){
+        data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED){
+            close(fd);
+            return false;
+        }
+    }
+    // ? the mapping stays valid after the file is closed
+    close(fd);
+
+    this->mapping = new Mapping();
+    this->mapping->data = data;
+    this->mapping->size = info.st_size;
+    this->mapping->references = 1;
+    return true;
+}
+
+void MappedFile::release(){
+    if (this->mapping != NULL && __atomic_sub_fetch(&this->mapping->references, 1, __ATOMIC_ACQ_REL) == 0){
+        if (this->mapping->data != NULL){
+            munmap(this->mapping->data, this->mapping->size);
+        }
+        delete this->mapping;
+    }
+    this->mapping = NULL;
+}
+
+// * Methods
+const void *MappedFile::data() const {
+    return this->mapping == NULL ? NULL : this->mapping->data;
+}
+
+size_t MappedFile::size() const {
+    return this->mapping == NULL ? 0 : this->mapping->size;
+}
+
+bool MappedFile::isOpen() const {
+    return this->mapping != NULL;
+}
+
+// ? 64-bit hash of the content, 8 bytes per step: a file that changed without changing its size
+// ? or its modification time doesn't give the same checksum
+unsigned long long MappedFile::checksum() const {
+    const unsigned char *bytes = static_cast<const unsigned char *>(this->data());
+    size_t size = this->size();
+    unsigned long long hash = 0xcbf29ce484222325ULL ^ size;
+    size_t i = 0;
+
+    for (; i + sizeof(unsigned long long) <= size; i += sizeof(unsigned long long)){
+        unsigned long long word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * 0x100000001b3ULL;
+        hash ^= hash >> 29;
+    }
+    for (; i < size; i++){
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
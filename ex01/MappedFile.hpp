@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   MappedFile.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:56:55 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:04 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MAPPEDFILE_HPP
+# define MAPPEDFILE_HPP
+
+// * Includes
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include <new>
+
+// * Class With Orthodox Canonical Form
+// ? read-only memory mapping of a whole file, the pages are only read from disk when they are touched
+// ? copies share the same mapping, it is unmapped when the last copy is destroyed
+// ? the size is the one fstat() gives for the descriptor that is mapped, not a second look at the path
+class MappedFile {
+    // ! private
+    private:
+        // * Shared mapping
+        struct Mapping {
+            void *data;
+            size_t size;
+            size_t references;
+        };
+
+        Mapping *mapping;
+
+        // * Helpers
+        void release();
+        bool map(const std::string &path);
+
+    // ! public
+    public:
+        // * Default constructor
+        MappedFile();
+
+        // * Parametrised constructor
+        // ! throws when the file can't be opened or mapped
+        MappedFile(const std::string &path);
+
+        // ? same, but a file that can't be opened or mapped gives a closed MappedFile (isOpen() is false)
+        MappedFile(const std::string &path, const std::nothrow_t &);
+
+        // * Copy constructor
+        MappedFile(const MappedFile &other);
+
+        // * Copy assignment operator
+        MappedFile &operator=(const MappedFile &other);
+
+        // * Destructor
+        ~MappedFile();
+
+        // * Methods
+        const void *data() const;
+        size_t size() const;
+        bool isOpen() const;
+        unsigned long long checksum() const;
+};
+#endif
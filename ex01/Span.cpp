@@ -6,11 +6,17 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/06 08:41:39 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/08 09:24:45 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 20:15:05 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Span.hpp"
+#include <queue>
+#include <cmath>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <limits>
 
 // * ──────────────────────────────────────────────────────────────
 // ?    ⚙️ C++ STANDARD TEMPLATE LIBRARY (STL) — COMPLETE GUIDE
@@ -209,87 +215,549 @@
 
 
 
+// * Histogram buckets
+// ? 0 for gaps smaller than 1, otherwise i for gaps in [2^(i-1), 2^i): the number of bits of an integer gap
+static size_t gapBucket(unsigned long long gap){
+    return gap == 0 ? 0 : sizeof(unsigned long long) * 8 - __builtin_clzll(gap);
+}
+
+static size_t gapBucket(unsigned long gap){
+    return gapBucket(static_cast<unsigned long long>(gap));
+}
+
+static size_t gapBucket(unsigned int gap){
+    return gapBucket(static_cast<unsigned long long>(gap));
+}
+
+static size_t gapBucket(double gap){
+    int exponent;
+
+    if (gap < 1){
+        return 0;
+    }
+    std::frexp(gap, &exponent);
+    return exponent;
+}
+
+// * Memory accounting
+// ? tell the lifecycle policy about the block a vector took, when its capacity changed since `before`
+template<typename Class, typename T>
+static void countAllocation(const std::vector<T> &vector, size_t before){
+    if (vector.capacity() != before){
+        DefaultLog::allocated<Class>(vector.capacity() * sizeof(T));
+    }
+}
+
+// * Sorted cache file
+// ? `path`.sorted starts with this header, the sorted numbers follow it
+// ? it is only used when it was written for a file with the same size and the same content checksum as `path`
+// ? (see MappedFile::checksum()), the modification time isn't trusted: it can be coarse or not move at all
+struct SortedCacheHeader {
+    char magic[8];
+    unsigned int typeSize;
+    unsigned int headerSize;
+    unsigned long long count;
+    unsigned long long sourceSize;
+    unsigned long long sourceChecksum;
+    // ? 64 bytes in total, so the numbers after it stay aligned
+    char padding[24];
+};
+
+// ? the second version of the header, the caches with the size and mtime header are just not used
+static const char sortedCacheMagic[8] = {'S', 'P', 'A', 'N', 'S', 'R', 'T', '2'};
+
+static SortedCacheHeader sortedCacheHeader(const MappedFile &source, size_t typeSize, size_t count){
+    SortedCacheHeader header;
+
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, sortedCacheMagic, sizeof(header.magic));
+    header.typeSize = typeSize;
+    header.headerSize = sizeof(header);
+    header.count = count;
+    header.sourceSize = source.size();
+    header.sourceChecksum = source.checksum();
+    return header;
+}
+
+// * Storage
+template<typename T>
+BasicSpan<T>::Storage::Storage(): mapped(NULL), count(0), sortedCount(0), minValue(0), maxValue(0), dirty(true),
+    shortest(0), references(1){
+    pthread_mutex_init(&this->lock, NULL);
+}
+
+template<typename T>
+BasicSpan<T>::Storage::~Storage(){
+    pthread_mutex_destroy(&this->lock);
+}
+
+// ! when the storage is shared, only call it with the lock held
+template<typename T>
+const T *BasicSpan<T>::Storage::data() const {
+    if (this->mapped != NULL){
+        return this->mapped;
+    }
+    return this->vector.empty() ? NULL : &this->vector[0];
+}
+
+// ? copy the mapped numbers into vector, so they can be written or sorted, and unmap the file
+// ! the storage must not be shared, or the lock must be held
+template<typename T>
+void BasicSpan<T>::Storage::materialize(size_t capacity){
+    if (this->mapped == NULL){
+        return;
+    }
+
+    size_t before = this->vector.capacity();
+    this->vector.reserve(std::max(capacity, this->count));
+    countAllocation<BasicSpan<T> >(this->vector, before);
+    this->vector.assign(this->mapped, this->mapped + this->count);
+    this->mapped = NULL;
+    this->file = MappedFile();
+}
+
 // * Default constructor
-Span::Span(): sizeOfvector(0){
-    std::cout << "Default constructor of Span is called" << std::endl;
+template<typename T>
+BasicSpan<T>::BasicSpan(): sizeOfvector(0), storage(NULL), threads(1), radixThreshold(RADIX_THRESHOLD){
+    this->share(emptyStorage());
+
+    DefaultLog::event<BasicSpan>("Span", DefaultConstructed);
 }
 
 // * Parametrised constructor
-Span::Span(const unsigned int &size): sizeOfvector(size){
-    
-    std::cout << "Parametrised constructor of Span is called" << std::endl;
+template<typename T>
+BasicSpan<T>::BasicSpan(const unsigned int &size): sizeOfvector(size), storage(new Storage()), threads(1), radixThreshold(RADIX_THRESHOLD){
+    // * reserve once so filling the span never reallocates
+    this->storage->vector.reserve(size);
+    countAllocation<BasicSpan>(this->storage->vector, 0);
+
+    DefaultLog::event<BasicSpan>("Span", Constructed);
 }
 
 // * Copy constructor with initializer list
-Span::Span(const Span &other){
+template<typename T>
+BasicSpan<T>::BasicSpan(const BasicSpan &other): sizeOfvector(0), storage(NULL), threads(1), radixThreshold(RADIX_THRESHOLD){
     // ! call copy assignment operator
     *this = other;
 
-    std::cout << "Copy constructor of Span is called" << std::endl;
+    DefaultLog::event<BasicSpan>("Span", CopyConstructed);
 }
 
 // * Copy assignment operator
-Span &Span::operator=(const Span &other){
-    this->sizeOfvector = other.sizeOfvector;
+// ? the numbers are shared, not copied: see detach()
+template<typename T>
+BasicSpan<T> &BasicSpan<T>::operator=(const BasicSpan &other){
+    if (this != &other){
+        this->release();
+        this->share(other.storage);
+        this->sizeOfvector = other.sizeOfvector;
+        this->threads = other.threads;
+        this->radixThreshold = other.radixThreshold;
+    }
     
-    std::cout << "Copy assignment operator of Span is called" << std::endl;
+    DefaultLog::event<BasicSpan>("Span", CopyAssigned);
     
     return *this;
 }
 
+#if __cplusplus >= 201103L
+// * Move constructor
+// ? other is left empty, with a capacity of 0
+template<typename T>
+BasicSpan<T>::BasicSpan(BasicSpan &&other) noexcept: sizeOfvector(other.sizeOfvector), storage(other.storage),
+    threads(other.threads), radixThreshold(other.radixThreshold), scratch(std::move(other.scratch)){
+    other.sizeOfvector = 0;
+    other.storage = NULL;
+    other.share(emptyStorage());
+
+    DefaultLog::event<BasicSpan>("Span", MoveConstructed);
+}
+
+// * Move assignment operator
+template<typename T>
+BasicSpan<T> &BasicSpan<T>::operator=(BasicSpan &&other) noexcept{
+    if (this != &other){
+        std::swap(this->sizeOfvector, other.sizeOfvector);
+        std::swap(this->storage, other.storage);
+        std::swap(this->threads, other.threads);
+        std::swap(this->radixThreshold, other.radixThreshold);
+        this->scratch.swap(other.scratch);
+    }
+
+    DefaultLog::event<BasicSpan>("Span", MoveAssigned);
+
+    return *this;
+}
+#endif
+
 // * Destructor
-Span::~Span(){
-    std::cout << "Span is destroyed" << std::endl;
+template<typename T>
+BasicSpan<T>::~BasicSpan(){
+    this->release();
+
+    DefaultLog::event<BasicSpan>("Span", Destroyed);
+}
+
+// * Helpers
+// ? one empty storage per type is shared by the default constructed and moved from spans, so they don't allocate
+// ! it starts with one reference that is never released, a span writing to it always detaches first
+template<typename T>
+typename BasicSpan<T>::Storage *BasicSpan<T>::emptyStorage(){
+    static Storage empty;
+
+    return &empty;
+}
+
+template<typename T>
+void BasicSpan<T>::share(Storage *storage){
+    __atomic_fetch_add(&storage->references, 1, __ATOMIC_RELAXED);
+    this->storage = storage;
+}
+
+template<typename T>
+void BasicSpan<T>::release(){
+    if (this->storage != NULL && __atomic_sub_fetch(&this->storage->references, 1, __ATOMIC_ACQ_REL) == 0){
+        delete this->storage;
+    }
+    this->storage = NULL;
+}
+
+// ? called before every write: a storage shared with other spans is copied first, so they don't see the write
+template<typename T>
+void BasicSpan<T>::detach(){
+    if (__atomic_load_n(&this->storage->references, __ATOMIC_ACQUIRE) == 1){
+        this->storage->materialize(this->sizeOfvector);
+        return;
+    }
+
+    Storage *copy = new Storage();
+    // ! reserved before taking the lock, so a failed allocation can't leave it locked
+    copy->vector.reserve(std::max(static_cast<size_t>(this->sizeOfvector), this->storage->count));
+    countAllocation<BasicSpan>(copy->vector, 0);
+    pthread_mutex_lock(&this->storage->lock);
+    const T *numbers = this->storage->data();
+    copy->vector.assign(numbers, numbers + this->storage->count);
+    copy->count = this->storage->count;
+    copy->sortedCount = this->storage->sortedCount;
+    copy->minValue = this->storage->minValue;
+    copy->maxValue = this->storage->maxValue;
+    copy->dirty = this->storage->dirty;
+    copy->shortest = this->storage->shortest;
+    pthread_mutex_unlock(&this->storage->lock);
+
+    this->release();
+    this->storage = copy;
+}
+
+// ? sort only the numbers added since the last query and merge them with the sorted prefix,
+// ? so repeated queries without addNumber() don't sort the vector again
+// ! the storage lock must be held
+template<typename T>
+void BasicSpan<T>::sortNumbers(){
+    Storage &storage = *this->storage;
+
+    if (storage.sortedCount == storage.count){
+        return;
+    }
+
+    // ! a mapped file is read-only, the numbers are sorted in memory
+    storage.materialize(this->sizeOfvector);
+
+    T *first = &storage.vector[0];
+    T *last = first + storage.count;
+    size_t before = this->scratch.capacity();
+    sortRange(first + storage.sortedCount, last, this->threads, this->radixThreshold, this->scratch);
+    countAllocation<BasicSpan>(this->scratch, before);
+    mergeRange(first, first + storage.sortedCount, last, this->scratch);
+    storage.sortedCount = storage.count;
+}
+
+// ? update min and max with the numbers stored from the index `from`
+// ! the storage must not be shared
+template<typename T>
+void BasicSpan<T>::trackMinMax(size_t from){
+    Storage &storage = *this->storage;
+
+    if (from == storage.count){
+        return;
+    }
+
+    if (from == 0){
+        storage.minValue = storage.vector[0];
+        storage.maxValue = storage.vector[0];
+    }
+
+    const T *first = &storage.vector[0];
+    minMaxVector(first + from, first + storage.count, storage.minValue, storage.maxValue);
+
+    storage.dirty = true;
 }
 
 // * Methods
-void Span::addNumber(int number){
-    if (this->sizeOfvector == this->vector.size()){
+template<typename T>
+void BasicSpan<T>::addNumber(T number){
+    if (this->sizeOfvector == this->storage->count){
         throw std::runtime_error("The size is full");
     }
 
-    this->vector.push_back(number);
+    this->detach();
+    this->storage->vector.push_back(number);
+    this->storage->count++;
+
+    // * track min and max so longestSpan() doesn't need to sort
+    this->trackMinMax(this->storage->count - 1);
 }
 
-int Span::shortestSpan(){
-    if (this->vector.size() == 0 || this->vector.size() == 1){
+template<typename T>
+typename BasicSpan<T>::result_type BasicSpan<T>::shortestSpan(){
+    Storage &storage = *this->storage;
+
+    if (storage.count == 0 || storage.count == 1){
         throw std::runtime_error("Add more numbers");
     }
 
-    // * sort the vector
-    std::sort(this->vector.begin(), this->vector.end());
+    pthread_mutex_lock(&storage.lock);
+    try {
+        if (storage.dirty){
+            // * sort the vector
+            this->sortNumbers();
 
-    // * after sorting store the range between sorted number in another vector
-    std::vector<int>rangeBetweenNumbers;
-    for (size_t i = 0; i < this->vector.size(); i++){
-        for (size_t j = i + 1; j < this->vector.size(); j++){
-            rangeBetweenNumbers.push_back(abs(this->vector[i] - this->vector[j]));
+            // * after sorting the shortest span is always between two neighbours
+            const T *first = storage.data();
+            storage.shortest = smallestGap(first, first + storage.count, this->threads);
+            storage.dirty = false;
         }
+    } catch (...){
+        pthread_mutex_unlock(&storage.lock);
+        throw;
     }
-    // * sort the ranges
-    std::sort(rangeBetweenNumbers.begin(), rangeBetweenNumbers.end());
-    
-    return *rangeBetweenNumbers.begin();
+    result_type result = storage.shortest;
+    pthread_mutex_unlock(&storage.lock);
+
+    return result;
+}
+
+
+template<typename T>
+typename BasicSpan<T>::result_type BasicSpan<T>::longestSpan(){
+    if (this->storage->count == 0 || this->storage->count == 1){
+        throw std::runtime_error("Add more numbers");
+    }
+
+    // * the longest span is always between the smallest and the biggest number
+    return SpanTraits<T>::distance(this->storage->minValue, this->storage->maxValue);
 }
 
+// ? sorts once, then one pass over the neighbours gives the shortest span, the k smallest gaps and the histogram
+template<typename T>
+typename BasicSpan<T>::Statistics BasicSpan<T>::statistics(size_t k){
+    Storage &storage = *this->storage;
 
-int Span::longestSpan(){
-    if (this->vector.size() == 0 || this->vector.size() == 1){
+    if (storage.count == 0 || storage.count == 1){
         throw std::runtime_error("Add more numbers");
     }
 
-    // * sort the vector
-    std::sort(this->vector.begin(), this->vector.end());
+    Statistics statistics;
+    // ? the biggest of the k smallest gaps seen so far is on top, so it is the one replaced
+    std::priority_queue<Gap> smallest;
 
-    // * after sorting store the range between sorted number in another vector
-    std::vector<int>rangeBetweenNumbers;
-    for (size_t i = 0; i < this->vector.size(); i++){
-        for (size_t j = i + 1; j < this->vector.size(); j++){
-            rangeBetweenNumbers.push_back(abs(this->vector[i] - this->vector[j]));
+    pthread_mutex_lock(&storage.lock);
+    try {
+        this->sortNumbers();
+
+        const T *numbers = storage.data();
+        Gap gap;
+        for (size_t i = 1; i < storage.count; i++){
+            gap.gap = SpanTraits<T>::distance(numbers[i - 1], numbers[i]);
+            gap.low = numbers[i - 1];
+            gap.high = numbers[i];
+
+            if (i == 1 || gap.gap < statistics.shortest){
+                statistics.shortest = gap.gap;
+            }
+
+            if (smallest.size() < k){
+                smallest.push(gap);
+            } else if (k > 0 && gap < smallest.top()){
+                smallest.pop();
+                smallest.push(gap);
+            }
+
+            size_t bucket = gapBucket(gap.gap);
+            if (bucket >= statistics.histogram.size()){
+                statistics.histogram.resize(bucket + 1, 0);
+            }
+            statistics.histogram[bucket]++;
         }
+
+        storage.shortest = statistics.shortest;
+        storage.dirty = false;
+    } catch (...){
+        pthread_mutex_unlock(&storage.lock);
+        throw;
     }
-    // * sort the ranges
-    std::sort(rangeBetweenNumbers.begin(), rangeBetweenNumbers.end());
-    
-    return rangeBetweenNumbers[rangeBetweenNumbers.size() - 1];
+    pthread_mutex_unlock(&storage.lock);
+
+    statistics.longest = SpanTraits<T>::distance(storage.minValue, storage.maxValue);
+    statistics.smallestGaps.resize(smallest.size());
+    for (size_t i = smallest.size(); i > 0; i--){
+        statistics.smallestGaps[i - 1] = smallest.top();
+        smallest.pop();
+    }
+
+    return statistics;
+}
+
+template<typename T>
+bool BasicSpan<T>::Gap::operator<(const Gap &other) const {
+    if (this->gap != other.gap){
+        return this->gap < other.gap;
+    }
+    return this->low < other.low;
+}
+
+// * Files
+template<typename T>
+BasicSpan<T> BasicSpan<T>::load(const std::string &path){
+    // ? the size comes from the descriptor that is mapped, the file can't change between the two
+    MappedFile source(path, std::nothrow);
+    if (!source.isOpen()){
+        throw std::runtime_error("Can't open " + path);
+    }
+    if (source.size() % sizeof(T) != 0){
+        throw std::runtime_error(path + " doesn't hold a whole number of values");
+    }
+
+    // ! the capacity of a span is an unsigned int, a file with more numbers can't be one span
+    size_t count = source.size() / sizeof(T);
+    if (count > std::numeric_limits<unsigned int>::max()){
+        throw std::runtime_error(path + " holds more numbers than a span can");
+    }
+
+    // ! the storage is made by hand: the parametrised constructor would reserve memory for every number
+    BasicSpan span;
+    span.release();
+    span.storage = new Storage();
+    span.sizeOfvector = count;
+    Storage &storage = *span.storage;
+    if (count == 0){
+        return span;
+    }
+
+    // * the sorted cache is enough when it matches the file: no sort and no scan for min and max
+    // ? checking it costs one read of the file for the checksum, much less than the sort it saves
+    SortedCacheHeader expected = sortedCacheHeader(source, sizeof(T), count);
+    MappedFile cache(path + ".sorted", std::nothrow);
+    if (cache.isOpen() && cache.size() == sizeof(expected) + count * sizeof(T)){
+        if (std::memcmp(cache.data(), &expected, sizeof(expected)) == 0){
+            storage.file = cache;
+            storage.mapped = reinterpret_cast<const T *>(static_cast<const char *>(cache.data()) + sizeof(expected));
+            storage.count = count;
+            storage.sortedCount = count;
+            storage.minValue = storage.mapped[0];
+            storage.maxValue = storage.mapped[count - 1];
+            return span;
+        }
+    }
+
+    // * otherwise the file itself is mapped, min and max cost one read of every page
+    storage.file = source;
+    storage.mapped = static_cast<const T *>(storage.file.data());
+    storage.count = count;
+    storage.minValue = storage.mapped[0];
+    storage.maxValue = storage.mapped[0];
+    minMaxVector(storage.mapped, storage.mapped + count, storage.minValue, storage.maxValue);
+    return span;
+}
+
+// ? both files are written next to the old ones and renamed over them, so a span still mapping them keeps working
+template<typename T>
+void BasicSpan<T>::save(const std::string &path){
+    Storage &storage = *this->storage;
+    std::string temporary = path + ".tmp";
+    bool written;
+
+    pthread_mutex_lock(&storage.lock);
+    try {
+        std::ofstream file(temporary.c_str(), std::ios::binary | std::ios::trunc);
+        if (storage.count > 0){
+            file.write(reinterpret_cast<const char *>(storage.data()), storage.count * sizeof(T));
+        }
+        written = file.good();
+    } catch (...){
+        pthread_mutex_unlock(&storage.lock);
+        throw;
+    }
+    pthread_mutex_unlock(&storage.lock);
+
+    if (!written || std::rename(temporary.c_str(), path.c_str()) != 0){
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Can't write " + path);
+    }
+    this->saveSortedCache(path);
+}
+
+template<typename T>
+void BasicSpan<T>::saveSortedCache(const std::string &path){
+    Storage &storage = *this->storage;
+
+    MappedFile source(path, std::nothrow);
+    if (!source.isOpen()){
+        throw std::runtime_error("Can't open " + path);
+    }
+    if (source.size() != storage.count * sizeof(T)){
+        throw std::runtime_error(path + " doesn't hold the numbers of this span");
+    }
+
+    std::string temporary = path + ".sorted.tmp";
+    SortedCacheHeader header = sortedCacheHeader(source, sizeof(T), storage.count);
+    bool written;
+
+    pthread_mutex_lock(&storage.lock);
+    try {
+        this->sortNumbers();
+
+        std::ofstream file(temporary.c_str(), std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        if (storage.count > 0){
+            file.write(reinterpret_cast<const char *>(storage.data()), storage.count * sizeof(T));
+        }
+        written = file.good();
+    } catch (...){
+        pthread_mutex_unlock(&storage.lock);
+        throw;
+    }
+    pthread_mutex_unlock(&storage.lock);
+
+    if (!written || std::rename(temporary.c_str(), (path + ".sorted").c_str()) != 0){
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Can't write " + path + ".sorted");
+    }
+}
+
+// ? 0 and 1 both mean the serial path
+template<typename T>
+void BasicSpan<T>::setThreads(unsigned int threads){
+    this->threads = threads == 0 ? 1 : threads;
+}
+
+// ? 0 means every sort is a radix sort, use a huge value to always use std::sort
+template<typename T>
+void BasicSpan<T>::setRadixThreshold(size_t threshold){
+    this->radixThreshold = threshold;
 }
+
+// * Explicit instantiations for every type of SpanTraits.hpp
+template class BasicSpan<char>;
+template class BasicSpan<signed char>;
+template class BasicSpan<unsigned char>;
+template class BasicSpan<short>;
+template class BasicSpan<unsigned short>;
+template class BasicSpan<int>;
+template class BasicSpan<unsigned int>;
+template class BasicSpan<long>;
+template class BasicSpan<unsigned long>;
+template class BasicSpan<long long>;
+template class BasicSpan<unsigned long long>;
+template class BasicSpan<float>;
+template class BasicSpan<double>;
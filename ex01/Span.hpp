@@ -6,7 +6,7 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/06 08:41:42 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/06 12:09:29 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 20:13:13 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,35 +17,177 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <iterator>
+#include <string>
+#include <pthread.h>
+#include "SpanEngine.hpp"
+#include "MappedFile.hpp"
+#include "../common/Lifecycle.hpp"
 
 // * Class With Orthodox Canonical Form
-class Span {
+// * Template Class
+// ? T is any type of SpanTraits.hpp, the spans are returned as SpanTraits<T>::result_type so they never overflow
+// ? the member functions are defined in Span.cpp and instantiated there for every supported type
+// ? copies share their numbers (copy-on-write): copying is O(1) and the numbers are only copied
+// ? when a span that shares them is written with addNumber() or addNumbers()
+template<typename T>
+class BasicSpan {
+    // ! public
+    public:
+        typedef typename SpanTraits<T>::result_type result_type;
+
+        // * Gap between two neighbours once sorted
+        struct Gap {
+            result_type gap;
+            T low;
+            T high;
+
+            // ? a smaller gap comes first, on a tie the smaller numbers do
+            bool operator<(const Gap &other) const;
+        };
+
+        // * Everything statistics() finds in one pass
+        // ? smallestGaps: the k smallest gaps, from the smallest one
+        // ? histogram[0]: gaps smaller than 1 (0 for integers), histogram[i]: gaps in [2^(i-1), 2^i)
+        struct Statistics {
+            result_type shortest;
+            result_type longest;
+            std::vector<Gap> smallestGaps;
+            std::vector<size_t> histogram;
+        };
+
     // ! private
     private:
+        // * Shared numbers and the query engine state that depends on them
+        struct Storage {
+            std::vector<T>vector;
+            // ? numbers of a mapped file, used instead of vector until they are written or sorted (see materialize())
+            MappedFile file;
+            const T *mapped;
+            // ? number of numbers, it never changes while the storage is shared
+            size_t count;
+
+            // ? vector[0, sortedCount) is kept sorted, new numbers are appended after it
+            size_t sortedCount;
+            T minValue;
+            T maxValue;
+            // ? shortest is only valid while dirty is false
+            bool dirty;
+            result_type shortest;
+
+            // ? number of spans sharing this storage
+            size_t references;
+            // ? sorting doesn't change the numbers, so spans sharing them sort them under this lock
+            pthread_mutex_t lock;
+
+            Storage();
+            ~Storage();
+
+            const T *data() const;
+            void materialize(size_t capacity);
+
+            private:
+                Storage(const Storage &other);
+                Storage &operator=(const Storage &other);
+        };
+
         unsigned int sizeOfvector;
-        std::vector<int>vector;
-        std::vector<int>::iterator it;
+        Storage *storage;
+
+        // * Per span settings and buffers, they are not shared
+        // ? number of threads used to sort and scan big spans
+        unsigned int threads;
+        // ? from this many new numbers the sort is a radix sort, scratch is its reusable buffer
+        size_t radixThreshold;
+        std::vector<T>scratch;
+
+        // * Helpers
+        static Storage *emptyStorage();
+        void share(Storage *storage);
+        void release();
+        void detach();
+        void sortNumbers();
+        void trackMinMax(size_t from);
+
+        // ? a single pass range can't be counted first: the numbers go one by one, each one checked
+        template<typename Iterator>
+        void addRange(Iterator first, Iterator last, std::input_iterator_tag){
+            for (; first != last; ++first){
+                this->addNumber(*first);
+            }
+        }
+
+        // ? a forward range is counted first: one capacity check and one copy for the batch
+        template<typename Iterator>
+        void addRange(Iterator first, Iterator last, std::forward_iterator_tag){
+            size_t count = std::distance(first, last);
+
+            if (count > this->sizeOfvector - this->storage->count){
+                throw std::runtime_error("The size is full");
+            }
+
+            this->detach();
+            size_t from = this->storage->count;
+            this->storage->vector.insert(this->storage->vector.end(), first, last);
+            this->storage->count = this->storage->vector.size();
+            this->trackMinMax(from);
+        }
 
     // ! public
     public:
         // * Default constructor
-        Span();
+        BasicSpan();
 
         // * Parametrised constructor
-        Span(const unsigned int &size);
+        BasicSpan(const unsigned int &size);
 
         // * Copy constructor
-        Span(const Span &other);
+        BasicSpan(const BasicSpan &other);
 
         // * Copy assignment operator
-        Span &operator=(const Span &other);
+        BasicSpan &operator=(const BasicSpan &other);
+
+#if __cplusplus >= 201103L
+        // * Move constructor
+        BasicSpan(BasicSpan &&other) noexcept;
+
+        // * Move assignment operator
+        BasicSpan &operator=(BasicSpan &&other) noexcept;
+#endif
 
         // * Destructor
-        ~Span();
+        ~BasicSpan();
         
         // * Methods
-        void addNumber(int number);
-        int shortestSpan();
-        int longestSpan();
+        void addNumber(T number);
+
+        // ? add a whole range at once, see addRange()
+        // ! an input range (std::istream_iterator...) that doesn't fit throws at the first number over the size,
+        // ! the numbers before it stay added
+        template<typename Iterator>
+        void addNumbers(Iterator first, Iterator last){
+            this->addRange(first, last, typename std::iterator_traits<Iterator>::iterator_category());
+        }
+
+        result_type shortestSpan();
+        result_type longestSpan();
+        Statistics statistics(size_t k);
+
+        // * Files
+        // ? a file is the raw numbers of type T one after the other, in the byte order of the machine
+        // ? load() maps it without copying, the span is full: its capacity is the number of numbers in the file
+        // ? when `path`.sorted was written by save() or saveSortedCache() for this same file, it is mapped
+        // ? instead and the numbers don't need to be sorted again
+        // ! the numbers are only copied into memory when the span is written, or sorted without that cache
+        // ! a file of more than UINT_MAX numbers is rejected, the capacity of a span is an unsigned int
+        static BasicSpan load(const std::string &path);
+        void save(const std::string &path);
+        void saveSortedCache(const std::string &path);
+        void setThreads(unsigned int threads);
+        void setRadixThreshold(size_t threshold);
 };
-#endif
\ No newline at end of file
+
+// * The original Span of int
+typedef BasicSpan<int> Span;
+
+#endif
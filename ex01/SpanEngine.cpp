@@ -0,0 +1,460 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SpanEngine.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:41:08 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:08:41 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "SpanEngine.hpp"
+#include "../common/CpuFeatures.hpp"
+#include <limits>
+#include <pthread.h>
+
+// * One shard of work given to a thread
+template<typename T>
+struct Shard {
+    T *first;
+    T *middle;
+    T *last;
+    // ? the part of the scratch buffer that belongs to this shard
+    T *scratch;
+    size_t radixThreshold;
+    typename SpanTraits<T>::result_type gap;
+};
+
+// * Radix sort
+// ? byte `shift / 8` of the number, with the sign bit flipped so the order is the same as for T
+template<typename T>
+static inline unsigned int radixDigit(T number, unsigned int shift){
+    return (SpanTraits<T>::key(number) >> shift) & 0xFF;
+}
+
+template<typename T>
+void radixSort(T *first, T *last, T *scratch){
+    const unsigned int passes = sizeof(T);
+    size_t size = last - first;
+    size_t counts[sizeof(T)][256] = {{0}};
+
+    if (size < 2){
+        return;
+    }
+
+    // * count every byte in one pass
+    for (size_t i = 0; i < size; i++){
+        for (unsigned int pass = 0; pass < passes; pass++){
+            counts[pass][radixDigit(first[i], pass * 8)]++;
+        }
+    }
+
+    T *from = first;
+    T *to = scratch;
+    for (unsigned int pass = 0; pass < passes; pass++){
+        // ! every number has the same byte here, this pass wouldn't move anything
+        if (counts[pass][radixDigit(first[0], pass * 8)] == size){
+            continue;
+        }
+
+        size_t offsets[256];
+        size_t offset = 0;
+        for (unsigned int digit = 0; digit < 256; digit++){
+            offsets[digit] = offset;
+            offset += counts[pass][digit];
+        }
+        for (size_t i = 0; i < size; i++){
+            to[offsets[radixDigit(from[i], pass * 8)]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+
+    if (from != first){
+        std::copy(from, from + size, first);
+    }
+}
+
+// ? radix sort for integers from the threshold, std::sort for the rest and for floating point numbers
+template<typename T, bool radix>
+struct SortKernel {
+    static void sort(T *first, T *last, T *scratch, size_t radixThreshold){
+        if (static_cast<size_t>(last - first) >= radixThreshold){
+            radixSort(first, last, scratch);
+        } else {
+            std::sort(first, last);
+        }
+    }
+};
+
+template<typename T>
+struct SortKernel<T, false> {
+    static void sort(T *first, T *last, T *, size_t){
+        std::sort(first, last);
+    }
+};
+
+// * Scalar reductions
+template<typename T>
+typename SpanTraits<T>::result_type gapScalar(const T *first, const T *last){
+    if (first >= last){
+        return std::numeric_limits<typename SpanTraits<T>::result_type>::max();
+    }
+    typename SpanTraits<T>::result_type gap = SpanTraits<T>::distance(first[-1], first[0]);
+
+    for (const T *it = first + 1; it < last && gap != 0; it++){
+        if (SpanTraits<T>::distance(it[-1], it[0]) < gap){
+            gap = SpanTraits<T>::distance(it[-1], it[0]);
+        }
+    }
+    return gap;
+}
+
+template<typename T>
+void minMaxScalar(const T *first, const T *last, T &min, T &max){
+    for (const T *it = first; it < last; it++){
+        if (*it < min){
+            min = *it;
+        }
+        if (*it > max){
+            max = *it;
+        }
+    }
+}
+
+#if CPU_X86
+// * SSE2 reductions
+// ! SSE2 has no min/max for 32-bit integers, so they are done with a compare and a select
+static inline __m128i min128(__m128i a, __m128i b){
+    __m128i mask = _mm_cmplt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static inline __m128i max128(__m128i a, __m128i b){
+    __m128i mask = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// ? the gaps are unsigned, flipping the sign bit turns the unsigned order into the signed one
+__attribute__((target("sse2")))
+static unsigned int gapSse2(const int *first, const int *last){
+    size_t size = last - first;
+    size_t i = 0;
+    unsigned int gap = SpanTraits<int>::distance(first[-1], first[0]);
+
+    if (size >= 4){
+        const __m128i signBit = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        __m128i best = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(gap)), signBit);
+        for (; i + 4 <= size; i += 4){
+            __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+            __m128i previous = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i - 1));
+            best = min128(best, _mm_xor_si128(_mm_sub_epi32(current, previous), signBit));
+        }
+        unsigned int lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), _mm_xor_si128(best, signBit));
+        gap = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+    }
+    if (i < size){
+        gap = std::min(gap, gapScalar(first + i, last));
+    }
+    return gap;
+}
+
+__attribute__((target("sse2")))
+static void minMaxSse2(const int *first, const int *last, int &min, int &max){
+    size_t size = last - first;
+    size_t i = 0;
+
+    if (size >= 4){
+        __m128i low = _mm_set1_epi32(min);
+        __m128i high = _mm_set1_epi32(max);
+        for (; i + 4 <= size; i += 4){
+            __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i *>(first + i));
+            low = min128(low, current);
+            high = max128(high, current);
+        }
+        int lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), low);
+        min = std::min(std::min(lanes[0], lanes[1]), std::min(lanes[2], lanes[3]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), high);
+        max = std::max(std::max(lanes[0], lanes[1]), std::max(lanes[2], lanes[3]));
+    }
+    minMaxScalar(first + i, last, min, max);
+}
+
+// * AVX2 reductions
+__attribute__((target("avx2")))
+static unsigned int gapAvx2(const int *first, const int *last){
+    size_t size = last - first;
+    size_t i = 0;
+    unsigned int gap = SpanTraits<int>::distance(first[-1], first[0]);
+
+    if (size >= 8){
+        __m256i best = _mm256_set1_epi32(static_cast<int>(gap));
+        for (; i + 8 <= size; i += 8){
+            __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i));
+            __m256i previous = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i - 1));
+            best = _mm256_min_epu32(best, _mm256_sub_epi32(current, previous));
+        }
+        unsigned int lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), best);
+        gap = *std::min_element(lanes, lanes + 8);
+    }
+    if (i < size){
+        gap = std::min(gap, gapScalar(first + i, last));
+    }
+    return gap;
+}
+
+__attribute__((target("avx2")))
+static void minMaxAvx2(const int *first, const int *last, int &min, int &max){
+    size_t size = last - first;
+    size_t i = 0;
+
+    if (size >= 8){
+        __m256i low = _mm256_set1_epi32(min);
+        __m256i high = _mm256_set1_epi32(max);
+        for (; i + 8 <= size; i += 8){
+            __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + i));
+            low = _mm256_min_epi32(low, current);
+            high = _mm256_max_epi32(high, current);
+        }
+        int lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), low);
+        min = *std::min_element(lanes, lanes + 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), high);
+        max = *std::max_element(lanes, lanes + 8);
+    }
+    minMaxScalar(first + i, last, min, max);
+}
+#endif
+
+// * Runtime dispatch
+// ? the gap and min/max scans of int run on the widest registers of the CPU (see CpuFeatures.hpp),
+// ? the other types and the CPUs without SSE2 or AVX2 keep the scalar loops
+typedef unsigned int (*GapKernel)(const int *, const int *);
+typedef void (*MinMaxKernel)(const int *, const int *, int &, int &);
+
+// ? only 32-bit integers have vectorized kernels, the other types use the scalar loops
+template<typename T>
+typename SpanTraits<T>::result_type gapVector(const T *first, const T *last){
+    return gapScalar(first, last);
+}
+
+template<typename T>
+void minMaxVector(const T *first, const T *last, T &min, T &max){
+    minMaxScalar(first, last, min, max);
+}
+
+// ? the kernel is chosen on the first scan, a sharded scan makes its first call from several threads at once
+template<>
+unsigned int gapVector<int>(const int *first, const int *last){
+    if (first >= last){
+        return std::numeric_limits<unsigned int>::max();
+    }
+#if CPU_X86
+    static GapKernel kernel = pickKernel<GapKernel>(gapAvx2, gapSse2, gapScalar<int>);
+
+    return kernel(first, last);
+#else
+    return gapScalar(first, last);
+#endif
+}
+
+// ? the difference of two unsigned numbers has the same bits as for int, so the same kernel works
+template<>
+unsigned int gapVector<unsigned int>(const unsigned int *first, const unsigned int *last){
+    return gapVector(reinterpret_cast<const int *>(first), reinterpret_cast<const int *>(last));
+}
+
+template<>
+void minMaxVector<int>(const int *first, const int *last, int &min, int &max){
+#if CPU_X86
+    static MinMaxKernel kernel = pickKernel<MinMaxKernel>(minMaxAvx2, minMaxSse2, minMaxScalar<int>);
+
+    kernel(first, last, min, max);
+#else
+    minMaxScalar(first, last, min, max);
+#endif
+}
+
+// * Thread routines
+template<typename T>
+static void *sortShard(void *arg){
+    Shard<T> *shard = static_cast<Shard<T> *>(arg);
+
+    SortKernel<T, SpanTraits<T>::radix>::sort(shard->first, shard->last, shard->scratch, shard->radixThreshold);
+    return NULL;
+}
+
+template<typename T>
+static void *mergeShard(void *arg){
+    Shard<T> *shard = static_cast<Shard<T> *>(arg);
+
+    // ? merge into the scratch buffer and copy back, inplace_merge would allocate its own buffer
+    std::merge(shard->first, shard->middle, shard->middle, shard->last, shard->scratch);
+    std::copy(shard->scratch, shard->scratch + (shard->last - shard->first), shard->first);
+    return NULL;
+}
+
+// ? a shard also looks at the number right before it, so the gaps on the boundaries are not lost
+template<typename T>
+static void *gapShard(void *arg){
+    Shard<T> *shard = static_cast<Shard<T> *>(arg);
+
+    shard->gap = gapVector<T>(shard->first, shard->last);
+    return NULL;
+}
+
+// ? run routine on every shard, each one in its own thread
+// ! if a thread can't be created its shard is done by the calling thread
+template<typename T>
+static void runShards(std::vector<Shard<T> > &shards, void *(*routine)(void *)){
+    std::vector<pthread_t> ids(shards.size());
+    std::vector<bool> started(shards.size(), false);
+
+    for (size_t i = 0; i < shards.size(); i++){
+        started[i] = pthread_create(&ids[i], NULL, routine, &shards[i]) == 0;
+        if (!started[i]){
+            routine(&shards[i]);
+        }
+    }
+    for (size_t i = 0; i < shards.size(); i++){
+        if (started[i]){
+            pthread_join(ids[i], NULL);
+        }
+    }
+}
+
+// ? cut [first, last) in `count` shards of the same size, scratch is cut the same way when there is one
+template<typename T>
+static std::vector<Shard<T> > makeShards(T *first, T *last, size_t count, T *scratch, size_t radixThreshold){
+    std::vector<Shard<T> > shards(count);
+    size_t size = last - first;
+
+    for (size_t i = 0; i < count; i++){
+        shards[i].first = first + size * i / count;
+        shards[i].last = first + size * (i + 1) / count;
+        shards[i].middle = shards[i].last;
+        shards[i].scratch = scratch == NULL ? NULL : scratch + size * i / count;
+        shards[i].radixThreshold = radixThreshold;
+        shards[i].gap = 0;
+    }
+    return shards;
+}
+
+static size_t shardCount(size_t size, unsigned int threads){
+    if (threads <= 1 || size < PARALLEL_THRESHOLD){
+        return 1;
+    }
+    return std::min(static_cast<size_t>(threads), size / (PARALLEL_THRESHOLD / 2));
+}
+
+// * Functions
+template<typename T>
+void sortRange(T *first, T *last, unsigned int threads, size_t radixThreshold, std::vector<T> &scratch){
+    size_t size = last - first;
+    size_t count = shardCount(size, threads);
+
+    // ? nothing to order, and an empty scratch has no &scratch[0]
+    if (size < 2){
+        return;
+    }
+    if (scratch.size() < size){
+        scratch.resize(size);
+    }
+
+    // * sort every shard, in parallel when there is more than one
+    std::vector<Shard<T> > runs = makeShards(first, last, count, &scratch[0], radixThreshold);
+    if (count == 1){
+        sortShard<T>(&runs[0]);
+        return;
+    }
+    runShards(runs, sortShard<T>);
+
+    // * then merge the sorted runs two by two, each round halves the number of runs
+    while (runs.size() > 1){
+        std::vector<Shard<T> > merges;
+        std::vector<Shard<T> > next;
+
+        for (size_t i = 0; i + 1 < runs.size(); i += 2){
+            Shard<T> merge = runs[i];
+            merge.middle = runs[i].last;
+            merge.last = runs[i + 1].last;
+            merges.push_back(merge);
+            next.push_back(merge);
+        }
+        if (runs.size() % 2 == 1){
+            next.push_back(runs.back());
+        }
+        runShards(merges, mergeShard<T>);
+        runs = next;
+    }
+}
+
+template<typename T>
+void mergeRange(T *first, T *middle, T *last, std::vector<T> &scratch){
+    if (first == middle || middle == last){
+        return;
+    }
+    if (scratch.size() < static_cast<size_t>(last - first)){
+        scratch.resize(last - first);
+    }
+
+    Shard<T> merge = makeShards(first, last, 1, &scratch[0], 0)[0];
+    merge.middle = middle;
+    mergeShard<T>(&merge);
+}
+
+template<typename T>
+typename SpanTraits<T>::result_type smallestGap(const T *first, const T *last, unsigned int threads){
+    if (last - first < 2){
+        return std::numeric_limits<typename SpanTraits<T>::result_type>::max();
+    }
+    // ! the first number has no neighbour before it, so the shards start at the second one
+    std::vector<Shard<T> > shards = makeShards(const_cast<T *>(first) + 1, const_cast<T *>(last),
+        shardCount(last - first, threads), static_cast<T *>(NULL), 0);
+
+    if (shards.size() == 1){
+        gapShard<T>(&shards[0]);
+    } else {
+        runShards(shards, gapShard<T>);
+    }
+
+    typename SpanTraits<T>::result_type gap = shards[0].gap;
+    for (size_t i = 1; i < shards.size(); i++){
+        if (shards[i].gap < gap){
+            gap = shards[i].gap;
+        }
+    }
+    return gap;
+}
+
+// * Explicit instantiations for every type of SpanTraits.hpp
+# define SPAN_ENGINE_INSTANTIATE(type)                                                            \
+    template void sortRange<type>(type *, type *, unsigned int, size_t, std::vector<type> &);      \
+    template void mergeRange<type>(type *, type *, type *, std::vector<type> &);                   \
+    template SpanTraits<type>::result_type smallestGap<type>(const type *, const type *, unsigned int); \
+    template SpanTraits<type>::result_type gapScalar<type>(const type *, const type *);            \
+    template SpanTraits<type>::result_type gapVector<type>(const type *, const type *);            \
+    template void minMaxScalar<type>(const type *, const type *, type &, type &);                  \
+    template void minMaxVector<type>(const type *, const type *, type &, type &)
+
+# define SPAN_ENGINE_INSTANTIATE_RADIX(type)                                                      \
+    SPAN_ENGINE_INSTANTIATE(type);                                                                \
+    template void radixSort<type>(type *, type *, type *)
+
+SPAN_ENGINE_INSTANTIATE_RADIX(char);
+SPAN_ENGINE_INSTANTIATE_RADIX(signed char);
+SPAN_ENGINE_INSTANTIATE_RADIX(unsigned char);
+SPAN_ENGINE_INSTANTIATE_RADIX(short);
+SPAN_ENGINE_INSTANTIATE_RADIX(unsigned short);
+SPAN_ENGINE_INSTANTIATE_RADIX(int);
+SPAN_ENGINE_INSTANTIATE_RADIX(unsigned int);
+SPAN_ENGINE_INSTANTIATE_RADIX(long);
+SPAN_ENGINE_INSTANTIATE_RADIX(unsigned long);
+SPAN_ENGINE_INSTANTIATE_RADIX(long long);
+SPAN_ENGINE_INSTANTIATE_RADIX(unsigned long long);
+SPAN_ENGINE_INSTANTIATE(float);
+SPAN_ENGINE_INSTANTIATE(double);
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SpanEngine.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:41:08 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:08:47 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPANENGINE_HPP
+# define SPANENGINE_HPP
+
+// * Includes
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include "SpanTraits.hpp"
+
+// * Below this many numbers the threads cost more than they save
+# define PARALLEL_THRESHOLD 65536
+
+// * From this many numbers a shard is sorted with a radix sort instead of std::sort
+# define RADIX_THRESHOLD 256
+
+// * Functions
+// ? the templates are defined in SpanEngine.cpp and instantiated there for every type of SpanTraits.hpp
+
+// ? sort [first, last) in place: radix sort for the integer types from radixThreshold numbers,
+// ? std::sort below it and for floating point numbers
+// ? with threads > 1 the work is split in shards, the result is the same as the serial path
+// ? scratch is grown to the size of the range and kept by the caller, so sorting again doesn't allocate
+template<typename T>
+void sortRange(T *first, T *last, unsigned int threads, size_t radixThreshold, std::vector<T> &scratch);
+template<typename T>
+void mergeRange(T *first, T *middle, T *last, std::vector<T> &scratch);
+template<typename T>
+typename SpanTraits<T>::result_type smallestGap(const T *first, const T *last, unsigned int threads);
+
+// ? LSD radix sort on bytes, the sign bit is flipped so negative numbers come first
+// ? like sortRange(), a range of fewer than two numbers is left as it is
+// ! scratch must hold at least last - first numbers, T must be an integer
+template<typename T>
+void radixSort(T *first, T *last, T *scratch);
+
+// * Reductions
+// ? gap*() return the smallest it[0] - it[-1] for every it in [first, last), so first[-1] must exist
+// ? an empty range has no gap: the result is the max of result_type, smallestGap() too under two numbers
+// ? the *Vector() versions use AVX2 or SSE2 when the CPU has them (for 32-bit integers),
+// ? otherwise they are the *Scalar() ones
+template<typename T>
+typename SpanTraits<T>::result_type gapScalar(const T *first, const T *last);
+template<typename T>
+typename SpanTraits<T>::result_type gapVector(const T *first, const T *last);
+template<typename T>
+void minMaxScalar(const T *first, const T *last, T &min, T &max);
+template<typename T>
+void minMaxVector(const T *first, const T *last, T &min, T &max);
+
+// * Specializations with vectorized kernels
+template<>
+unsigned int gapVector<int>(const int *first, const int *last);
+template<>
+unsigned int gapVector<unsigned int>(const unsigned int *first, const unsigned int *last);
+template<>
+void minMaxVector<int>(const int *first, const int *last, int &min, int &max);
+
+#endif
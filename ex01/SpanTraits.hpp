@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SpanTraits.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:46:24 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 18:46:24 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SPANTRAITS_HPP
+# define SPANTRAITS_HPP
+
+// * Includes
+#include <cstddef>
+
+// * Traits of the types a Span can store
+// ? result_type: type returned by shortestSpan() and longestSpan(), wide enough for any difference
+// ? key_type: unsigned integer of the same size, used by the radix sort
+// ? radix: true when the numbers can be radix sorted, the others use std::sort
+// ? distance(low, high): high - low without overflow, low must not be bigger than high
+// ! there is no generic version, a Span of an unsupported type doesn't compile
+template<typename T>
+struct SpanTraits;
+
+// * Integers: the difference is done on the unsigned type of the same size, it can't overflow there
+# define SPAN_INTEGER_TRAITS(type, keyType, resultType, isSigned)                          \
+    template<>                                                                                \
+    struct SpanTraits<type> {                                                                 \
+        typedef keyType key_type;                                                             \
+        typedef resultType result_type;                                                       \
+        enum { radix = true };                                                                \
+        static key_type key(type number){                                                     \
+            const key_type signBit = static_cast<key_type>(1) << (sizeof(key_type) * 8 - 1); \
+            return static_cast<key_type>(static_cast<key_type>(number) ^ (isSigned ? signBit : 0)); \
+        }                                                                                     \
+        static result_type distance(type low, type high){                                     \
+            return static_cast<key_type>(static_cast<key_type>(high) - static_cast<key_type>(low)); \
+        }                                                                                     \
+    }
+
+SPAN_INTEGER_TRAITS(char, unsigned char, unsigned int, static_cast<char>(-1) < 0);
+SPAN_INTEGER_TRAITS(signed char, unsigned char, unsigned int, true);
+SPAN_INTEGER_TRAITS(unsigned char, unsigned char, unsigned int, false);
+SPAN_INTEGER_TRAITS(short, unsigned short, unsigned int, true);
+SPAN_INTEGER_TRAITS(unsigned short, unsigned short, unsigned int, false);
+SPAN_INTEGER_TRAITS(int, unsigned int, unsigned int, true);
+SPAN_INTEGER_TRAITS(unsigned int, unsigned int, unsigned int, false);
+SPAN_INTEGER_TRAITS(long, unsigned long, unsigned long, true);
+SPAN_INTEGER_TRAITS(unsigned long, unsigned long, unsigned long, false);
+SPAN_INTEGER_TRAITS(long long, unsigned long long, unsigned long long, true);
+SPAN_INTEGER_TRAITS(unsigned long long, unsigned long long, unsigned long long, false);
+
+# undef SPAN_INTEGER_TRAITS
+
+// * Floating point: compared with std::sort, the difference is done in double
+# define SPAN_FLOAT_TRAITS(type)                                                            \
+    template<>                                                                                \
+    struct SpanTraits<type> {                                                                 \
+        typedef type key_type;                                                                \
+        typedef double result_type;                                                           \
+        enum { radix = false };                                                               \
+        static result_type distance(type low, type high){                                     \
+            return static_cast<result_type>(high) - static_cast<result_type>(low);            \
+        }                                                                                     \
+    }
+
+SPAN_FLOAT_TRAITS(float);
+SPAN_FLOAT_TRAITS(double);
+
+# undef SPAN_FLOAT_TRAITS
+
+#endif
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WindowSpan.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:40:40 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:21:31 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "WindowSpan.hpp"
+
+// * Default constructor
+WindowSpan::WindowSpan(): sizeOfWindow(0){
+    DefaultLog::event<WindowSpan>("WindowSpan", DefaultConstructed);
+}
+
+// * Parametrised constructor
+WindowSpan::WindowSpan(const unsigned int &size): sizeOfWindow(size){
+    DefaultLog::event<WindowSpan>("WindowSpan", Constructed);
+}
+
+// * Copy constructor
+WindowSpan::WindowSpan(const WindowSpan &other){
+    // ! call copy assignment operator
+    *this = other;
+
+    DefaultLog::event<WindowSpan>("WindowSpan", CopyConstructed);
+}
+
+// * Copy assignment operator
+WindowSpan &WindowSpan::operator=(const WindowSpan &other){
+    if (this != &other){
+        this->sizeOfWindow = other.sizeOfWindow;
+        this->window = other.window;
+        this->values = other.values;
+        this->gaps = other.gaps;
+    }
+
+    DefaultLog::event<WindowSpan>("WindowSpan", CopyAssigned);
+
+    return *this;
+}
+
+// * Destructor
+WindowSpan::~WindowSpan(){
+    DefaultLog::event<WindowSpan>("WindowSpan", Destroyed);
+}
+
+// * Helpers
+// ? the new number splits the gap between its two neighbours into two gaps
+void WindowSpan::insertValue(int number){
+    std::multiset<int>::iterator it = this->values.insert(number);
+    std::multiset<int>::iterator next = it;
+    ++next;
+
+    bool hasPrev = it != this->values.begin();
+    bool hasNext = next != this->values.end();
+    std::multiset<int>::iterator prev = it;
+    if (hasPrev){
+        --prev;
+        this->gaps.insert(SpanTraits<int>::distance(*prev, number));
+    }
+    if (hasNext){
+        this->gaps.insert(SpanTraits<int>::distance(number, *next));
+    }
+    if (hasPrev && hasNext){
+        this->gaps.erase(this->gaps.find(SpanTraits<int>::distance(*prev, *next)));
+    }
+}
+
+// ? removing a number joins the two gaps around it back into one
+void WindowSpan::eraseValue(int number){
+    std::multiset<int>::iterator it = this->values.find(number);
+    std::multiset<int>::iterator next = it;
+    ++next;
+
+    bool hasPrev = it != this->values.begin();
+    bool hasNext = next != this->values.end();
+    std::multiset<int>::iterator prev = it;
+    if (hasPrev){
+        --prev;
+        this->gaps.erase(this->gaps.find(SpanTraits<int>::distance(*prev, number)));
+    }
+    if (hasNext){
+        this->gaps.erase(this->gaps.find(SpanTraits<int>::distance(number, *next)));
+    }
+    if (hasPrev && hasNext){
+        this->gaps.insert(SpanTraits<int>::distance(*prev, *next));
+    }
+
+    this->values.erase(it);
+}
+
+// * Methods
+void WindowSpan::addNumber(int number){
+    if (this->sizeOfWindow == 0){
+        throw std::runtime_error("The size is full");
+    }
+
+    // * evict the oldest number when the window is full
+    if (this->window.size() == this->sizeOfWindow){
+        this->eraseValue(this->window.front());
+        this->window.pop_front();
+    }
+
+    this->window.push_back(number);
+    this->insertValue(number);
+}
+
+unsigned int WindowSpan::shortestSpan(){
+    if (this->window.size() == 0 || this->window.size() == 1){
+        throw std::runtime_error("Add more numbers");
+    }
+
+    return *this->gaps.begin();
+}
+
+unsigned int WindowSpan::longestSpan(){
+    if (this->window.size() == 0 || this->window.size() == 1){
+        throw std::runtime_error("Add more numbers");
+    }
+
+    return SpanTraits<int>::distance(*this->values.begin(), *this->values.rbegin());
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   WindowSpan.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:40:40 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:13:13 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WINDOWSPAN_HPP
+# define WINDOWSPAN_HPP
+
+// * Includes
+#include <iostream>
+#include <deque>
+#include <set>
+#include "SpanTraits.hpp"
+#include "../common/Lifecycle.hpp"
+
+// * Class With Orthodox Canonical Form
+// ? Span over the last `sizeOfWindow` numbers: when the window is full the oldest number is evicted
+// ? values keeps the window ordered and gaps keeps the distance between every two neighbours in values,
+// ? so each addNumber() is O(log N) and both queries are O(1)
+class WindowSpan {
+    // ! private
+    private:
+        unsigned int sizeOfWindow;
+        std::deque<int>window;
+        std::multiset<int>values;
+        std::multiset<unsigned int>gaps;
+
+        // * Helpers
+        void insertValue(int number);
+        void eraseValue(int number);
+
+    // ! public
+    public:
+        // * Default constructor
+        WindowSpan();
+
+        // * Parametrised constructor
+        WindowSpan(const unsigned int &size);
+
+        // * Copy constructor
+        WindowSpan(const WindowSpan &other);
+
+        // * Copy assignment operator
+        WindowSpan &operator=(const WindowSpan &other);
+
+        // * Destructor
+        ~WindowSpan();
+
+        // * Methods
+        void addNumber(int number);
+        unsigned int shortestSpan();
+        unsigned int longestSpan();
+};
+#endif
@@ -6,11 +6,35 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/05 20:54:18 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/06 16:06:46 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 20:10:32 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "Span.hpp"
+#include "WindowSpan.hpp"
+#include "ConcurrentSpan.hpp"
+#include "ApproxSpan.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <climits>
+#include <utility>
+
+// * Producer thread for the concurrent span: 1000 single numbers then 24 batches of 1000
+static void *produce(void *arg){
+    ConcurrentSpan<int> *span = static_cast<ConcurrentSpan<int> *>(arg);
+    std::vector<int> batch(1000);
+
+    for (int i = 0; i < 1000; i++){
+        span->addNumber(i * 7);
+    }
+    for (int b = 0; b < 24; b++){
+        for (int i = 0; i < 1000; i++){
+            batch[i] = (b * 1000 + i) * 7 + 7000;
+        }
+        span->addNumbers(batch.begin(), batch.end());
+    }
+    return NULL;
+}
 
 int main()
 {
@@ -23,6 +47,154 @@ int main()
         sp.addNumber(11);
         std::cout << sp.shortestSpan() << std::endl;
         std::cout << sp.longestSpan() << std::endl;
+
+        // * Both spans, the 3 smallest gaps and the gap histogram in one pass
+        Span::Statistics stats = sp.statistics(3);
+        std::cout << stats.shortest << " " << stats.longest << std::endl; // 2 14
+        for (size_t i = 0; i < stats.smallestGaps.size(); i++){
+            // 2 (9, 11)
+            // 3 (3, 6)
+            // 3 (6, 9)
+            std::cout << stats.smallestGaps[i].gap << " (" << stats.smallestGaps[i].low
+                      << ", " << stats.smallestGaps[i].high << ")" << std::endl;
+        }
+        for (size_t i = 0; i < stats.histogram.size(); i++){
+            std::cout << stats.histogram[i] << " "; // 0 0 3 1
+        }
+        std::cout << std::endl;
+
+        // * Big span: shortestSpan() sorts once, longestSpan() uses the tracked min and max
+        std::vector<int> numbers;
+        for (int i = 0; i < 100000; i++){
+            numbers.push_back(i * 3);
+        }
+        Span big = Span(100000);
+        big.setThreads(4);
+        big.addNumbers(numbers.begin(), numbers.end());
+        std::cout << big.shortestSpan() << std::endl;
+        std::cout << big.longestSpan() << std::endl;
+
+        // * Radix sort and std::sort must give the same result
+        std::srand(42);
+        std::vector<int> randoms;
+        for (int i = 0; i < 200000; i++){
+            randoms.push_back(std::rand() - RAND_MAX / 2);
+        }
+        // ? the whole sorted sequences are compared, two different orders can have the same smallest gap
+        std::vector<int> radix = randoms;
+        std::vector<int> comparison = randoms;
+        std::vector<int> scratch;
+        sortRange(&radix[0], &radix[0] + radix.size(), 4, 0, scratch);
+        std::sort(comparison.begin(), comparison.end());
+        std::cout << (radix == comparison ? "radix OK" : "radix KO") << std::endl;
+
+        // * Spans wider than INT_MAX don't overflow anymore
+        Span wide = Span(2);
+        wide.addNumber(INT_MIN);
+        wide.addNumber(INT_MAX);
+        std::cout << wide.longestSpan() << std::endl; // 4294967295
+
+        // * Other types: 64-bit timestamps, 16-bit sensors and doubles
+        BasicSpan<long long> timestamps = BasicSpan<long long>(3);
+        timestamps.addNumber(1700000000000LL);
+        timestamps.addNumber(-1700000000000LL);
+        timestamps.addNumber(1700000000005LL);
+        std::cout << timestamps.shortestSpan() << std::endl; // 5
+        std::cout << timestamps.longestSpan() << std::endl;  // 3400000000005
+
+        BasicSpan<short> sensors = BasicSpan<short>(3);
+        sensors.addNumber(-32768);
+        sensors.addNumber(32767);
+        sensors.addNumber(100);
+        std::cout << sensors.shortestSpan() << std::endl; // 32667
+        std::cout << sensors.longestSpan() << std::endl;  // 65535
+
+        BasicSpan<double> doubles = BasicSpan<double>(3);
+        doubles.addNumber(0.5);
+        doubles.addNumber(2.25);
+        doubles.addNumber(-1.0);
+        std::cout << doubles.shortestSpan() << std::endl; // 1.5
+        std::cout << doubles.longestSpan() << std::endl;  // 3.25
+
+        // * Copies share the numbers until one of them is written
+        Span snapshot = big;
+        std::cout << snapshot.longestSpan() << std::endl; // 299997
+        Span copy = Span(3);
+        copy.addNumber(1);
+        copy.addNumber(10);
+        Span before = copy;
+        copy.addNumber(11); // ? copy gets its own numbers here, before is unchanged
+        std::cout << before.shortestSpan() << std::endl; // 9
+        std::cout << copy.shortestSpan() << std::endl;   // 1
+
+#if __cplusplus >= 201103L
+        // * Moving hands the numbers over without touching them
+        Span moved = std::move(copy);
+        std::cout << moved.longestSpan() << std::endl; // 10
+#endif
+
+        // * Save the numbers with their sorted cache, the next load maps the cache and doesn't sort
+        big.save("span.bin");
+        Span loaded = Span::load("span.bin");
+        std::cout << loaded.shortestSpan() << std::endl; // 3
+        std::cout << loaded.longestSpan() << std::endl;  // 299997
+        std::remove("span.bin");
+        std::remove("span.bin.sorted");
+
+        // ! the whole range is rejected when it doesn't fit
+        big.addNumbers(numbers.begin(), numbers.begin() + 1);
+    } catch(const std::exception& e){
+        std::cerr << e.what() << std::endl;
+    }
+
+    try {
+        // * Window span: only the last 3 numbers are kept
+        WindowSpan ws = WindowSpan(3);
+        ws.addNumber(1);
+        ws.addNumber(2);
+        ws.addNumber(100);
+        std::cout << ws.shortestSpan() << std::endl; // 1
+        std::cout << ws.longestSpan() << std::endl;  // 99
+        ws.addNumber(50); // 1 is evicted
+        std::cout << ws.shortestSpan() << std::endl; // 48
+        std::cout << ws.longestSpan() << std::endl;  // 98
+        ws.addNumber(49); // 2 is evicted
+        std::cout << ws.shortestSpan() << std::endl; // 1
+        std::cout << ws.longestSpan() << std::endl;  // 51
+    } catch(const std::exception& e){
+        std::cerr << e.what() << std::endl;
+    }
+
+    try {
+        // * Approximate span: 2^8 buckets of 2^24 ints each, whatever the number of values
+        ApproxSpan<int> approx = ApproxSpan<int>(BucketBits(8));
+        for (int i = 0; i < 1000000; i++){
+            approx.addNumber(i * 1000);
+        }
+        approx.addNumber(-5);
+        std::cout << approx.longestSpan() << std::endl;  // 999999005 (exact)
+        std::cout << approx.shortestSpan() << std::endl; // 5 (between 5 and 5 + maxError())
+        std::cout << approx.maxError() << std::endl;     // 16777215
+
+        // ! the argument is a number of bits, a capacity like Span(size) would ask for 2^100000 buckets
+        ApproxSpan<int> huge = ApproxSpan<int>(BucketBits(100000));
+    } catch(const std::exception& e){
+        std::cerr << e.what() << std::endl;
+    }
+
+    try {
+        // * Concurrent span: 4 producers, 25000 numbers each
+        ConcurrentSpan<int> shared = ConcurrentSpan<int>(100000);
+        pthread_t producers[4];
+        for (int i = 0; i < 4; i++){
+            pthread_create(&producers[i], NULL, produce, &shared);
+        }
+        for (int i = 0; i < 4; i++){
+            pthread_join(producers[i], NULL);
+        }
+        std::cout << shared.shortestSpan() << std::endl; // 0
+        std::cout << shared.longestSpan() << std::endl;  // 174993
+        shared.addNumber(1); // ! full
     } catch(const std::exception& e){
         std::cerr << e.what() << std::endl;
     }
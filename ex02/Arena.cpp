@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Arena.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:11:45 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:11:45 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Arena.hpp"
+#include <algorithm>
+
+// * Default constructor
+Arena::Arena(): head(NULL), current(NULL), cursor(NULL), limit(NULL), chunkSize(ARENA_CHUNK_SIZE){
+}
+
+// * Parametrised constructor
+Arena::Arena(size_t chunkSize): head(NULL), current(NULL), cursor(NULL), limit(NULL), chunkSize(chunkSize){
+}
+
+// * Destructor
+Arena::~Arena(){
+    while (this->head != NULL){
+        Chunk *next = this->head->next;
+        ::operator delete(this->head);
+        this->head = next;
+    }
+}
+
+// * Helpers
+// ? the header is rounded up to 16 bytes so the data starts as aligned as operator new returns
+void Arena::enter(Chunk *chunk){
+    this->current = chunk;
+    this->cursor = reinterpret_cast<char *>(chunk) + ((sizeof(Chunk) + 15) & ~static_cast<size_t>(15));
+    this->limit = reinterpret_cast<char *>(chunk) + chunk->size;
+}
+
+// ? go to the chunk after the current one if it's big enough, otherwise put a new one there
+// ! a chunk that is too small is kept further in the list, it will be used after a reset()
+void Arena::nextChunk(size_t bytes){
+    size_t header = (sizeof(Chunk) + 15) & ~static_cast<size_t>(15);
+    Chunk *next = this->current == NULL ? this->head : this->current->next;
+
+    if (next == NULL || next->size < header + bytes){
+        size_t size = std::max(this->chunkSize, header + bytes);
+        Chunk *chunk = static_cast<Chunk *>(::operator new(size));
+        chunk->size = size;
+        chunk->next = next;
+        if (this->current == NULL){
+            this->head = chunk;
+        } else {
+            this->current->next = chunk;
+        }
+        next = chunk;
+    }
+    this->enter(next);
+}
+
+// * Methods
+void *Arena::allocate(size_t bytes, size_t alignment){
+    size_t padding = (alignment - reinterpret_cast<size_t>(this->cursor) % alignment) % alignment;
+
+    if (this->cursor == NULL || static_cast<size_t>(this->limit - this->cursor) < padding + bytes){
+        this->nextChunk(bytes + alignment);
+        padding = (alignment - reinterpret_cast<size_t>(this->cursor) % alignment) % alignment;
+    }
+    void *block = this->cursor + padding;
+    this->cursor += padding + bytes;
+    return block;
+}
+
+void Arena::reset(){
+    if (this->head != NULL){
+        this->enter(this->head);
+    }
+}
+
+// ? bytes held by the arena, used or not
+size_t Arena::capacity() const {
+    size_t total = 0;
+
+    for (Chunk *chunk = this->head; chunk != NULL; chunk = chunk->next){
+        total += chunk->size;
+    }
+    return total;
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Arena.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:11:45 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:07 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENA_HPP
+# define ARENA_HPP
+
+// * Includes
+#include <cstddef>
+#include <new>
+
+// * Size of a chunk when none is given
+# define ARENA_CHUNK_SIZE 65536
+
+// * Class
+// ? bump allocator: allocate() moves a cursor in a chunk, nothing is freed one by one
+// ? reset() gives all the memory back at once in O(1), the chunks are kept and reused
+// ! everything allocated in the arena must be dead (or never touched again) before reset()
+// ! not thread safe, one arena per thread
+class Arena {
+    // ! private
+    private:
+        // ? the data of a chunk follows its header, the chunks are kept in the order they were used
+        struct Chunk {
+            Chunk *next;
+            size_t size;
+        };
+
+        Chunk *head;
+        Chunk *current;
+        char *cursor;
+        char *limit;
+        size_t chunkSize;
+
+        // * Helpers
+        void enter(Chunk *chunk);
+        void nextChunk(size_t bytes);
+
+        // ! an arena owns its chunks, it can't be copied
+        Arena(const Arena &other);
+        Arena &operator=(const Arena &other);
+
+    // ! public
+    public:
+        // * Default constructor
+        Arena();
+
+        // * Parametrised constructor
+        Arena(size_t chunkSize);
+
+        // * Destructor
+        ~Arena();
+
+        // * Methods
+        // ! alignment must be a power of two
+        void *allocate(size_t bytes, size_t alignment);
+        void reset();
+        size_t capacity() const;
+};
+
+// * Template Class
+// ? standard allocator over an Arena, deallocate() does nothing and the memory comes back on Arena::reset()
+// ? copies (and rebinds) use the same arena, so the containers of a batch can all be released together
+template<typename T>
+class ArenaAllocator {
+    // ! public
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template<typename U>
+        struct rebind {
+            typedef ArenaAllocator<U> other;
+        };
+
+    // ! private
+    private:
+        Arena *arena;
+
+        template<typename U>
+        friend class ArenaAllocator;
+
+    // ! public
+    public:
+
+        // * Parametrised constructor
+        ArenaAllocator(Arena &arena): arena(&arena){
+        };
+
+        // * Copy constructor
+        ArenaAllocator(const ArenaAllocator &other): arena(other.arena){
+        };
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U> &other): arena(other.arena){
+        };
+
+        // * Copy assignment operator
+        ArenaAllocator &operator=(const ArenaAllocator &other){
+            this->arena = other.arena;
+
+            return *this;
+        };
+
+        // * Destructor
+        ~ArenaAllocator(){
+        };
+
+        // * Methods
+        pointer allocate(size_type count, const void * = NULL){
+            return static_cast<pointer>(this->arena->allocate(count * sizeof(T), __alignof__(T)));
+        }
+
+        void deallocate(pointer, size_type){
+        }
+
+        void construct(pointer place, const T &value){
+            new (place) T(value);
+        }
+
+        void destroy(pointer place){
+            place->~T();
+        }
+
+        pointer address(reference value) const {
+            return &value;
+        }
+
+        const_pointer address(const_reference value) const {
+            return &value;
+        }
+
+        size_type max_size() const {
+            return static_cast<size_type>(-1) / sizeof(T);
+        }
+
+        Arena *source() const {
+            return this->arena;
+        }
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b){
+    return a.source() == b.source();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b){
+    return a.source() != b.source();
+}
+#endif
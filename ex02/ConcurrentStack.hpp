@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ConcurrentStack.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:14:34 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:13:13 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENTSTACK_HPP
+# define CONCURRENTSTACK_HPP
+
+// * Includes
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "Epoch.hpp"
+#include "Pool.hpp"
+#include "../common/Lifecycle.hpp"
+
+// * Class With Orthodox Canonical Form
+// * Template Class
+// ? Lock-free stack (Treiber): push() and pop() swap the top with one compare and swap, no thread waits
+// ? for another. A popped node is retired to the Epoch, so a thread still reading it (and an ABA on the
+// ? top) can't happen: the node isn't deleted nor reused before every reader is gone
+// ? a node never changes once pushed, so the nodes reachable from one top are the stack at that moment:
+// ? snapshot() copies them without blocking the writers, in the order of MutantStack (bottom first)
+// ? Log is the lifecycle logging policy, like for MutantStack
+// ! copy, assignment and destruction are not thread safe, nothing else may use the stacks then
+template<typename T, typename Log = DefaultLog>
+class ConcurrentStack {
+    // ! private
+    private:
+        struct Node {
+            T value;
+            Node *next;
+
+            Node(const T &value): value(value), next(NULL){
+            }
+        };
+
+        Node *head;
+        size_t count;
+
+        // * Helpers
+        // ? the nodes come from the Pool: a node freed by collect() goes back to the next push() of the thread,
+        // ? or by the shared lists of the Pool to the thread that pushes when another one pops
+        static Node *createNode(const T &value){
+            void *block = Pool::allocate(sizeof(Node));
+            Log::template allocated<ConcurrentStack>(sizeof(Node));
+
+            try {
+                return new (block) Node(value);
+            } catch (...){
+                Pool::deallocate(block, sizeof(Node));
+                throw;
+            }
+        }
+
+        static void destroyNode(void *node){
+            static_cast<Node *>(node)->~Node();
+            Pool::deallocate(node, sizeof(Node));
+        }
+
+        void clear(){
+            Node *node = this->head;
+
+            while (node != NULL){
+                Node *next = node->next;
+                destroyNode(node);
+                node = next;
+            }
+            this->head = NULL;
+            this->count = 0;
+        }
+
+        // ? push the values from the bottom, so the copy has the same top
+        void pushAll(const std::vector<T> &values){
+            for (size_t i = 0; i < values.size(); i++){
+                this->push(values[i]);
+            }
+        }
+
+    // ! public
+    public:
+        // * Default constructor
+        ConcurrentStack(): head(NULL), count(0){
+            Log::template event<ConcurrentStack>("ConcurrentStack", DefaultConstructed);
+        };
+
+        // * Copy constructor
+        ConcurrentStack(const ConcurrentStack &other): head(NULL), count(0){
+            this->pushAll(other.snapshot());
+
+            Log::template event<ConcurrentStack>("ConcurrentStack", CopyConstructed);
+        };
+
+        // * Copy assignment operator
+        ConcurrentStack &operator=(const ConcurrentStack &other){
+            if (this != &other){
+                std::vector<T> values = other.snapshot();
+                this->clear();
+                this->pushAll(values);
+            }
+
+            Log::template event<ConcurrentStack>("ConcurrentStack", CopyAssigned);
+
+            return *this;
+        };
+
+        // * Destructor
+        ~ConcurrentStack(){
+            this->clear();
+
+            Log::template event<ConcurrentStack>("ConcurrentStack", Destroyed);
+        };
+
+        // * Methods
+        void push(const T &value){
+            Node *node = createNode(value);
+
+            node->next = __atomic_load_n(&this->head, __ATOMIC_RELAXED);
+            while (!__atomic_compare_exchange_n(&this->head, &node->next, node, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)){
+            }
+            __atomic_fetch_add(&this->count, 1, __ATOMIC_RELAXED);
+        }
+
+        // ? the top is copied into value and removed, false when the stack was empty
+        bool pop(T &value){
+            Epoch::Guard guard;
+            Node *top = __atomic_load_n(&this->head, __ATOMIC_ACQUIRE);
+
+            while (top != NULL){
+                if (__atomic_compare_exchange_n(&this->head, &top, top->next, true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)){
+                    value = top->value;
+                    __atomic_fetch_sub(&this->count, 1, __ATOMIC_RELAXED);
+                    Epoch::retire(top, destroyNode);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // ? copy of the top, false when the stack was empty
+        bool top(T &value) const {
+            Epoch::Guard guard;
+            Node *top = __atomic_load_n(&this->head, __ATOMIC_ACQUIRE);
+
+            if (top == NULL){
+                return false;
+            }
+            value = top->value;
+            return true;
+        }
+
+        // ? the stack as it was at one moment, bottom first
+        std::vector<T> snapshot() const {
+            Epoch::Guard guard;
+            std::vector<T> values;
+
+            for (Node *node = __atomic_load_n(&this->head, __ATOMIC_ACQUIRE); node != NULL; node = node->next){
+                values.push_back(node->value);
+            }
+            std::reverse(values.begin(), values.end());
+            return values;
+        }
+
+        // ! may be off while pushes and pops are running
+        size_t size() const {
+            return __atomic_load_n(&this->count, __ATOMIC_RELAXED);
+        }
+
+        bool empty() const {
+            return __atomic_load_n(&this->head, __ATOMIC_ACQUIRE) == NULL;
+        }
+};
+#endif
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Epoch.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:14:34 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:14:34 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Epoch.hpp"
+#include <pthread.h>
+
+Epoch::Record *Epoch::records = NULL;
+unsigned long Epoch::global = 0;
+
+// * Record of the calling thread
+static __thread void *mine = NULL;
+
+// ? the key only exists for its destructor, it gives the record back when the thread ends
+// ? the value of the key is the `owned` flag of the record
+static pthread_key_t releaseKey;
+static pthread_once_t releaseOnce = PTHREAD_ONCE_INIT;
+
+static void releaseAtExit(void *owned){
+    __atomic_store_n(static_cast<int *>(owned), 0, __ATOMIC_RELEASE);
+}
+
+static void createReleaseKey(){
+    pthread_key_create(&releaseKey, releaseAtExit);
+}
+
+// * Helpers
+// ? take a record nobody owns, or push a new one on the list
+Epoch::Record *Epoch::self(){
+    if (mine != NULL){
+        return static_cast<Record *>(mine);
+    }
+
+    Record *record = NULL;
+    for (Record *it = __atomic_load_n(&records, __ATOMIC_ACQUIRE); it != NULL && record == NULL; it = it->next){
+        int free = 0;
+        if (__atomic_compare_exchange_n(&it->owned, &free, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)){
+            record = it;
+        }
+    }
+    if (record == NULL){
+        record = new Record();
+        record->epoch = 0;
+        record->active = 0;
+        record->owned = 1;
+        record->depth = 0;
+        record->collectAt = EPOCH_COLLECT_THRESHOLD;
+        record->next = __atomic_load_n(&records, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&records, &record->next, record, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED)){
+        }
+    }
+
+    pthread_once(&releaseOnce, createReleaseKey);
+    pthread_setspecific(releaseKey, &record->owned);
+    mine = record;
+    return record;
+}
+
+// ? the epoch moves when no thread inside a guard is still on an older one
+void Epoch::tryAdvance(){
+    unsigned long current = __atomic_load_n(&global, __ATOMIC_ACQUIRE);
+
+    for (Record *it = __atomic_load_n(&records, __ATOMIC_ACQUIRE); it != NULL; it = it->next){
+        if (__atomic_load_n(&it->active, __ATOMIC_ACQUIRE) && __atomic_load_n(&it->epoch, __ATOMIC_ACQUIRE) != current){
+            return;
+        }
+    }
+    __atomic_compare_exchange_n(&global, &current, current + 1, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+// * Methods
+// ! the fence makes the announce visible before the thread reads any shared node
+void Epoch::enter(){
+    Record *record = self();
+
+    if (record->depth++ == 0){
+        __atomic_store_n(&record->active, 1, __ATOMIC_RELAXED);
+        __atomic_store_n(&record->epoch, __atomic_load_n(&global, __ATOMIC_ACQUIRE), __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+}
+
+void Epoch::leave(){
+    Record *record = self();
+
+    if (--record->depth == 0){
+        __atomic_store_n(&record->active, 0, __ATOMIC_RELEASE);
+    }
+}
+
+void Epoch::retire(void *object, void (*destroy)(void *)){
+    Record *record = self();
+    Retired retired;
+
+    retired.object = object;
+    retired.destroy = destroy;
+    retired.epoch = __atomic_load_n(&global, __ATOMIC_ACQUIRE);
+    record->limbo.push_back(retired);
+    if (record->limbo.size() >= record->collectAt){
+        collect();
+    }
+}
+
+// ? free what the calling thread retired at least two epochs ago
+void Epoch::collect(){
+    Record *record = self();
+
+    tryAdvance();
+    unsigned long current = __atomic_load_n(&global, __ATOMIC_ACQUIRE);
+    size_t kept = 0;
+    for (size_t i = 0; i < record->limbo.size(); i++){
+        if (record->limbo[i].epoch + 2 <= current){
+            record->limbo[i].destroy(record->limbo[i].object);
+        } else {
+            record->limbo[kept++] = record->limbo[i];
+        }
+    }
+    record->limbo.resize(kept);
+    record->collectAt = kept + EPOCH_COLLECT_THRESHOLD;
+}
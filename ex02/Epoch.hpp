@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Epoch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:14:34 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:14:34 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+// * Includes
+#include <cstddef>
+#include <vector>
+
+// * Objects a thread retires between two tries to free them
+# define EPOCH_COLLECT_THRESHOLD 64
+
+// * Class
+// ? epoch based reclamation: a lock-free structure can't delete a node it unlinked right away,
+// ? another thread may still be reading it, so the node is retired and deleted later
+// ? a thread reads the shared nodes inside a Guard, the guard announces the global epoch the thread saw
+// ? the global epoch only moves when every thread inside a guard saw the current one,
+// ? so two moves after a node was retired no thread can still hold it and it's deleted
+// ! a thread that stays inside a guard forever stops the reclamation (not the other threads)
+class Epoch {
+    // ! private
+    private:
+        struct Retired {
+            void *object;
+            void (*destroy)(void *);
+            unsigned long epoch;
+        };
+
+        // ? one record per thread, in a list that never shrinks: the record of a thread that ended
+        // ? is taken by the next new thread, with the objects it still had to free
+        struct Record {
+            Record *next;
+            unsigned long epoch;
+            int active;
+            int owned;
+            unsigned int depth;
+            std::vector<Retired> limbo;
+            // ? the next collect() happens when limbo gets this big, so a stuck epoch doesn't make
+            // ? every retire() walk the whole limbo again
+            size_t collectAt;
+        };
+
+        static Record *records;
+        static unsigned long global;
+
+        // * Helpers
+        static Record *self();
+        static void tryAdvance();
+
+        // ! there is one epoch for the whole process (records and global), an Epoch object would have nothing to hold
+        Epoch();
+
+    // ! public
+    public:
+        // * Methods
+        static void enter();
+        static void leave();
+        // ? destroy(object) is called once no thread can still read object
+        static void retire(void *object, void (*destroy)(void *));
+        static void collect();
+
+        // * Class
+        // ? enter() in the constructor, leave() in the destructor, the guards can be nested
+        class Guard {
+            // ! private
+            private:
+                Guard(const Guard &other);
+                Guard &operator=(const Guard &other);
+
+            // ! public
+            public:
+                // * Default constructor
+                Guard(){
+                    Epoch::enter();
+                };
+
+                // * Destructor
+                ~Guard(){
+                    Epoch::leave();
+                };
+        };
+};
+#endif
@@ -6,7 +6,7 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/06 18:34:43 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/08 10:06:07 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 20:13:13 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,63 +17,116 @@
 #include <iostream>
 #include <stack>
 #include <deque>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include "SmallVector.hpp"
+#include "StackTraits.hpp"
+#include "Arena.hpp"
+#include "Pool.hpp"
+#include "../common/Lifecycle.hpp"
 
 // * Class With Orthodox Canonical Form
-// * Tempate Class
-template<typename T>
-class MutantStack: public std::stack<T> {
+// * Template Class
+// ? Container is the storage of the stack, like for std::stack: std::deque by default,
+// ? std::vector to keep the elements contiguous or SmallVector to keep the first ones inside the object
+// ? Log is the lifecycle logging policy (CoutLog, NoLog, CountingLog), see Lifecycle.hpp
+template<typename T, typename Container = std::deque<T>, typename Log = DefaultLog>
+class MutantStack: public std::stack<T, Container> {
     // ! public
     public:
         // * Default constructor
         MutantStack(){
-            std::cout << "Default constructor of MutantStack is called" << std::endl;
+            Log::template event<MutantStack>("MutantStack", DefaultConstructed);
         };
 
-        // * Copy constructor
-        MutantStack(const MutantStack &other){
-            *this = other;
+        // * Parametrised constructor
+        // ? the storage takes its memory from allocator (an ArenaAllocator, a PoolAllocator...)
+        // ! before C++11 std::stack copies the container it's built with, the empty storage is built twice
+        explicit MutantStack(const typename Container::allocator_type &allocator): std::stack<T, Container>(Container(allocator)){
+            Log::template event<MutantStack>("MutantStack", Constructed);
+        };
 
-            std::cout << "Copy constructor of MutantStack is called" << std::endl;
+        // * Copy constructor
+        MutantStack(const MutantStack &other): std::stack<T, Container>(other){
+            Log::template event<MutantStack>("MutantStack", CopyConstructed);
         };
 
         // * Copy assignment operator
         MutantStack &operator=(const MutantStack &other){
-            std::stack<T>::operator=(other);
+            std::stack<T, Container>::operator=(other);
 
-            std::cout << "Copy assignment operator of MutantStack is called" << std::endl;
+            Log::template event<MutantStack>("MutantStack", CopyAssigned);
 
             return *this;
         };
 
         // * Destructor
         ~MutantStack(){
-            std::cout << "MutantStack is destroyed" << std::endl;
+            Log::template event<MutantStack>("MutantStack", Destroyed);
         };
         
         // * Methods
-        // ? Define a iterator of deque
-        typedef typename std::deque<T>::iterator iterator;
-        typedef typename std::deque<T>::const_iterator const_iterator;
+        // ? Define a iterator of the container
+        typedef typename Container::iterator iterator;
+        typedef typename Container::const_iterator const_iterator;
+        typedef typename Container::size_type size_type;
+
+        // ? the pop() of std::stack stays visible next to the bulk one
+        using std::stack<T, Container>::pop;
+
+        // * Bulk operations
+        // ? push every element of [first, last), the last one ends on top
+        // ? one insert at the end of the storage: one capacity check and one copy for the whole range
+        // ! not an overload of push(): push(3, 7) would be insert(end, 3, 7), three copies of 7
+        template<typename Iterator>
+        void push_range(Iterator first, Iterator last){
+            this->c.insert(this->c.end(), first, last);
+        }
+
+        // ? pop the `count` top elements into out, in the order pop() would give them (top first)
+        // ? one copy then one erase of the end of the storage, it returns out after the last element written
+        template<typename OutputIterator>
+        OutputIterator pop(size_type count, OutputIterator out){
+            if (count > this->c.size()){
+                throw std::runtime_error("Not enough elements in the stack");
+            }
+            iterator from = this->c.end();
+            std::advance(from, -static_cast<typename Container::difference_type>(count));
+            out = std::copy(std::reverse_iterator<iterator>(this->c.end()), std::reverse_iterator<iterator>(from), out);
+            this->c.erase(from, this->c.end());
+            return out;
+        }
+
+        // ? room for `capacity` elements without reallocating, when the storage has reserve() (see StackTraits.hpp)
+        void reserve(size_type capacity){
+            ReserveOf<Container>::reserve(this->c, capacity);
+        }
+
+        // ? give back the memory the storage doesn't use, when it can
+        void shrink_to_fit(){
+            ShrinkOf<Container>::shrink(this->c);
+        }
 
 
         // * For non-constant object
-        // ? this->c.begin(): this will return a iterator of first element on deque and last in stack
+        // ? this->c.begin(): this will return a iterator of first element on container and last in stack
         iterator begin(){
             return this->c.begin();
         }
         
-        // ? this->c.end(): this will return a iterator of last element on deque and first in stack
+        // ? this->c.end(): this will return a iterator of last element on container and first in stack
         iterator end(){
             return this->c.end();
         }
 
         // * For constant object
-        // ? this->c.begin(): this will return a iterator of first element on deque and last in stack
+        // ? this->c.begin(): this will return a iterator of first element on container and last in stack
         const_iterator begin() const {
             return this->c.begin();
         }
         
-        // ? this->c.end(): this will return a iterator of last element on deque and first in stack
+        // ? this->c.end(): this will return a iterator of last element on container and first in stack
         const_iterator end() const {
             return this->c.end();
         }
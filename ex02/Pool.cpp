@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Pool.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:12:01 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:06:00 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "Pool.hpp"
+#include <pthread.h>
+
+// * Free lists of the calling thread
+// ? a free block holds the pointer to the next one, so the lists cost no memory
+// ? the first block of a batch on the shared lists also holds the pointer to the next batch
+struct FreeBlock {
+    FreeBlock *next;
+    FreeBlock *nextBatch;
+};
+
+static __thread FreeBlock *freeLists[POOL_CLASSES];
+static __thread size_t freeCounts[POOL_CLASSES];
+
+// * Shared lists: batches of POOL_BATCH blocks that any thread can take
+static FreeBlock *sharedLists[POOL_CLASSES];
+static size_t sharedCounts[POOL_CLASSES];
+static pthread_mutex_t sharedLock = PTHREAD_MUTEX_INITIALIZER;
+
+// ? the key only exists for its destructor, it trims the lists of a thread when it ends
+static pthread_key_t trimKey;
+static pthread_once_t trimOnce = PTHREAD_ONCE_INIT;
+static __thread bool registered = false;
+
+static void trimAtExit(void *){
+    Pool::trim();
+}
+
+static void createTrimKey(){
+    pthread_key_create(&trimKey, trimAtExit);
+}
+
+// * Helpers
+// ? smallest class that holds `bytes`, POOL_CLASSES when it's too big for the pool
+static size_t classOf(size_t bytes){
+    size_t index = 0;
+    size_t size = 16;
+
+    while (index < POOL_CLASSES && size < bytes){
+        size <<= 1;
+        index++;
+    }
+    return index;
+}
+
+static void deleteChain(FreeBlock *block){
+    while (block != NULL){
+        FreeBlock *next = block->next;
+        ::operator delete(block);
+        block = next;
+    }
+}
+
+// ? the list of the thread is over POOL_LIST_LIMIT: its first POOL_BATCH blocks go to the shared list,
+// ? or back to operator delete when the shared list is full too
+static void giveBatch(size_t index){
+    FreeBlock *batch = freeLists[index];
+    FreeBlock *last = batch;
+
+    for (size_t i = 1; i < POOL_BATCH; i++){
+        last = last->next;
+    }
+    freeLists[index] = last->next;
+    freeCounts[index] -= POOL_BATCH;
+    last->next = NULL;
+
+    pthread_mutex_lock(&sharedLock);
+    if (sharedCounts[index] < POOL_SHARED_BATCHES){
+        batch->nextBatch = sharedLists[index];
+        sharedLists[index] = batch;
+        sharedCounts[index]++;
+        batch = NULL;
+    }
+    pthread_mutex_unlock(&sharedLock);
+    deleteChain(batch);
+}
+
+// ? the list of the thread is empty: it takes a whole batch from the shared list, NULL when there is none
+static FreeBlock *takeBatch(size_t index){
+    pthread_mutex_lock(&sharedLock);
+    FreeBlock *batch = sharedLists[index];
+    if (batch != NULL){
+        sharedLists[index] = batch->nextBatch;
+        sharedCounts[index]--;
+    }
+    pthread_mutex_unlock(&sharedLock);
+    return batch;
+}
+
+// * Methods
+void *Pool::allocate(size_t bytes){
+    size_t index = classOf(bytes);
+
+    if (index == POOL_CLASSES){
+        return ::operator new(bytes);
+    }
+    FreeBlock *block = freeLists[index];
+    if (block != NULL){
+        freeLists[index] = block->next;
+        freeCounts[index]--;
+        return block;
+    }
+    block = takeBatch(index);
+    if (block != NULL){
+        freeLists[index] = block->next;
+        freeCounts[index] = POOL_BATCH - 1;
+        return block;
+    }
+    return ::operator new(static_cast<size_t>(16) << index);
+}
+
+void Pool::deallocate(void *block, size_t bytes){
+    size_t index = classOf(bytes);
+
+    if (block == NULL){
+        return;
+    }
+    if (index == POOL_CLASSES){
+        ::operator delete(block);
+        return;
+    }
+    // ? the first block kept by a thread registers the trim at its exit
+    if (!registered){
+        pthread_once(&trimOnce, createTrimKey);
+        pthread_setspecific(trimKey, &registered);
+        registered = true;
+    }
+    FreeBlock *free = static_cast<FreeBlock *>(block);
+    free->next = freeLists[index];
+    freeLists[index] = free;
+    if (++freeCounts[index] > POOL_LIST_LIMIT){
+        giveBatch(index);
+    }
+}
+
+// ? give the free blocks of the calling thread back to operator delete, the shared batches stay
+void Pool::trim(){
+    for (size_t i = 0; i < POOL_CLASSES; i++){
+        deleteChain(freeLists[i]);
+        freeLists[i] = NULL;
+        freeCounts[i] = 0;
+    }
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   Pool.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:12:01 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:07 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef POOL_HPP
+# define POOL_HPP
+
+// * Includes
+#include <cstddef>
+#include <new>
+
+// * Size classes: 16, 32, 64... bytes up to 16 << (POOL_CLASSES - 1), bigger blocks skip the pool
+# define POOL_CLASSES 9
+
+// * Length of the lists
+// ? a thread keeps at most POOL_LIST_LIMIT free blocks per class, over that POOL_BATCH of them move
+// ? to a shared list, which keeps at most POOL_SHARED_BATCHES batches per class before operator delete
+# define POOL_LIST_LIMIT 256
+# define POOL_BATCH 128
+# define POOL_SHARED_BATCHES 64
+
+// * Class
+// ? free lists per thread and per size class: a freed block goes on the list of the thread that freed it
+// ? and the next allocation of the same class on that thread takes it back without operator new
+// ? the blocks of a thread are given back to operator delete when the thread ends, or with trim()
+// ? a block can be freed by another thread than the one that allocated it: when one thread only frees
+// ? (the consumer of a producer/consumer pair) its extra blocks go by batches through the shared list
+// ? to the thread that only allocates, so the memory stays bounded and is reused
+// ! the shared list takes a lock, once every POOL_BATCH blocks
+class Pool {
+    // ! private
+    private:
+        // ! only static methods, it can't be built
+        Pool();
+
+    // ! public
+    public:
+        // * Methods
+        static void *allocate(size_t bytes);
+        static void deallocate(void *block, size_t bytes);
+        static void trim();
+};
+
+// * Template Class
+// ? standard allocator over the Pool, all the PoolAllocators are interchangeable
+template<typename T>
+class PoolAllocator {
+    // ! public
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template<typename U>
+        struct rebind {
+            typedef PoolAllocator<U> other;
+        };
+
+        // * Default constructor
+        PoolAllocator(){
+        };
+
+        // * Copy constructor
+        PoolAllocator(const PoolAllocator &){
+        };
+
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U> &){
+        };
+
+        // * Copy assignment operator
+        PoolAllocator &operator=(const PoolAllocator &){
+            return *this;
+        };
+
+        // * Destructor
+        ~PoolAllocator(){
+        };
+
+        // * Methods
+        pointer allocate(size_type count, const void * = NULL){
+            return static_cast<pointer>(Pool::allocate(count * sizeof(T)));
+        }
+
+        void deallocate(pointer block, size_type count){
+            Pool::deallocate(block, count * sizeof(T));
+        }
+
+        void construct(pointer place, const T &value){
+            new (place) T(value);
+        }
+
+        void destroy(pointer place){
+            place->~T();
+        }
+
+        pointer address(reference value) const {
+            return &value;
+        }
+
+        const_pointer address(const_reference value) const {
+            return &value;
+        }
+
+        size_type max_size() const {
+            return static_cast<size_type>(-1) / sizeof(T);
+        }
+};
+
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &){
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &){
+    return false;
+}
+#endif
@@ -0,0 +1,338 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   SmallVector.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:09:13 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 20:12:07 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SMALLVECTOR_HPP
+# define SMALLVECTOR_HPP
+
+// * Includes
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <iterator>
+
+// * Template Class
+// ? Sequence that keeps its first N elements inside the object and only goes to the heap after,
+// ? it has what std::stack needs (back, push_back, pop_back...) so a MutantStack can run over it
+// ? the elements are always contiguous, iterators are plain pointers
+// ? the heap storage comes from Allocator, the inline one never does
+// ! like std::vector, a push_back that goes over the capacity invalidates every iterator
+template<typename T, size_t N = 32, typename Allocator = std::allocator<T> >
+class SmallVector {
+    // ! public
+    public:
+        typedef T value_type;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T *iterator;
+        typedef const T *const_iterator;
+        typedef Allocator allocator_type;
+
+    // ! private
+    private:
+        // ? raw memory for N elements, aligned for T even when T asks for more than the scalar types
+        // ? (an over-aligned struct), the other members of the union keep at least their alignment
+        union Buffer {
+            unsigned char bytes[N * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+            long double alignLongDouble;
+            long long alignLongLong;
+            void *alignPointer;
+        };
+
+        Buffer buffer;
+        Allocator allocator;
+        T *first;
+        size_t count;
+        size_t room;
+
+        // * Helpers
+        T *inlineData(){
+            return reinterpret_cast<T *>(this->buffer.bytes);
+        }
+
+        bool isInline() const {
+            return this->first == reinterpret_cast<const T *>(this->buffer.bytes);
+        }
+
+        // ? move the elements to a heap block of `capacity` elements, the old storage is released after
+        // ! if a copy throws the elements already copied are destroyed and nothing changes
+        void grow(size_t capacity){
+            T *block = this->allocator.allocate(capacity);
+            try {
+                std::uninitialized_copy(this->first, this->first + this->count, block);
+            } catch (...){
+                this->allocator.deallocate(block, capacity);
+                throw;
+            }
+            this->destroyAll();
+            this->release();
+            this->first = block;
+            this->room = capacity;
+        }
+
+        void destroyAll(){
+            for (size_t i = 0; i < this->count; i++){
+                this->first[i].~T();
+            }
+        }
+
+        void release(){
+            if (!this->isInline()){
+                this->allocator.deallocate(this->first, this->room);
+            }
+        }
+
+        // ? a single pass range: it can't be counted first, the elements go one by one at the end
+        // ? then a middle insertion takes them from a copy
+        template<typename Iterator>
+        void insertRange(T *position, Iterator from, Iterator to, std::input_iterator_tag){
+            if (position == this->first + this->count){
+                for (; from != to; ++from){
+                    this->push_back(*from);
+                }
+            } else {
+                SmallVector copy(this->allocator);
+                for (; from != to; ++from){
+                    copy.push_back(*from);
+                }
+                this->insertRange(position, copy.begin(), copy.end(), std::forward_iterator_tag());
+            }
+        }
+
+        // ? one capacity check for the whole range: it's copied into a new block with the elements around it,
+        // ? or in place after shifting the elements that follow position
+        // ! like std::vector, the range must not come from this SmallVector
+        template<typename Iterator>
+        void insertRange(T *position, Iterator from, Iterator to, std::forward_iterator_tag){
+            size_t added = std::distance(from, to);
+            T *last = this->first + this->count;
+
+            if (added == 0){
+                return;
+            }
+            if (this->count + added > this->room){
+                size_t capacity = std::max(this->room * 2, this->count + added);
+                T *block = this->allocator.allocate(capacity);
+                T *filled = block;
+                try {
+                    filled = std::uninitialized_copy(this->first, position, filled);
+                    filled = std::uninitialized_copy(from, to, filled);
+                    filled = std::uninitialized_copy(position, last, filled);
+                } catch (...){
+                    for (T *it = block; it != filled; ++it){
+                        it->~T();
+                    }
+                    this->allocator.deallocate(block, capacity);
+                    throw;
+                }
+                this->destroyAll();
+                this->release();
+                this->first = block;
+                this->room = capacity;
+            } else if (position == last){
+                std::uninitialized_copy(from, to, last);
+            } else {
+                size_t after = last - position;
+                if (after > added){
+                    std::uninitialized_copy(last - added, last, last);
+                    std::copy_backward(position, last - added, last);
+                    std::copy(from, to, position);
+                } else {
+                    Iterator middle = from;
+                    std::advance(middle, after);
+                    std::uninitialized_copy(middle, to, last);
+                    std::uninitialized_copy(position, last, last + (added - after));
+                    std::copy(from, middle, position);
+                }
+            }
+            this->count += added;
+        }
+
+    // ! public
+    public:
+        // * Default constructor
+        SmallVector(): allocator(), first(inlineData()), count(0), room(N){
+        };
+
+        // * Parametrised constructor
+        explicit SmallVector(const Allocator &allocator): allocator(allocator), first(inlineData()), count(0), room(N){
+        };
+
+        // * Copy constructor
+        // ? the copy uses the allocator of other, like the standard containers
+        SmallVector(const SmallVector &other): allocator(other.allocator), first(inlineData()), count(0), room(N){
+            *this = other;
+        };
+
+        // * Copy assignment operator
+        SmallVector &operator=(const SmallVector &other){
+            if (this != &other){
+                this->clear();
+                if (other.count > this->room){
+                    this->grow(other.count);
+                }
+                std::uninitialized_copy(other.first, other.first + other.count, this->first);
+                this->count = other.count;
+            }
+
+            return *this;
+        };
+
+        // * Destructor
+        ~SmallVector(){
+            this->destroyAll();
+            this->release();
+        };
+
+        // * Methods
+        // ? the value is copied before growing, it may be one of the elements that are moved
+        // ! with N = 0 the first push_back finds no room at all, the capacity starts at 1
+        void push_back(const T &value){
+            if (this->count == this->room){
+                T copy(value);
+                this->grow(std::max(static_cast<size_t>(1), this->room * 2));
+                new (this->first + this->count) T(copy);
+            } else {
+                new (this->first + this->count) T(value);
+            }
+            this->count++;
+        }
+
+        void pop_back(){
+            this->count--;
+            this->first[this->count].~T();
+        }
+
+        void clear(){
+            this->destroyAll();
+            this->count = 0;
+        }
+
+        void reserve(size_t capacity){
+            if (capacity > this->room){
+                this->grow(capacity);
+            }
+        }
+
+        // ? give back the heap block that isn't used: the elements go back inside the object when they fit,
+        // ? else to a heap block of exactly size() elements
+        void shrink_to_fit(){
+            if (this->isInline() || this->count == this->room){
+                return;
+            }
+            if (this->count > N){
+                this->grow(this->count);
+                return;
+            }
+            T *block = this->first;
+            std::uninitialized_copy(block, block + this->count, this->inlineData());
+            this->destroyAll();
+            this->release();
+            this->first = this->inlineData();
+            this->room = N;
+        }
+
+        // ? insert copies of [from, to) before position, see insertRange()
+        template<typename Iterator>
+        void insert(iterator position, Iterator from, Iterator to){
+            this->insertRange(position, from, to, typename std::iterator_traits<Iterator>::iterator_category());
+        }
+
+        // ? the elements after the erased ones move down, the last ones are destroyed
+        iterator erase(iterator from, iterator to){
+            T *last = this->first + this->count;
+            T *kept = std::copy(to, last, from);
+
+            for (T *it = kept; it != last; ++it){
+                it->~T();
+            }
+            this->count -= to - from;
+            return from;
+        }
+
+        reference back(){
+            return this->first[this->count - 1];
+        }
+
+        const_reference back() const {
+            return this->first[this->count - 1];
+        }
+
+        reference front(){
+            return this->first[0];
+        }
+
+        const_reference front() const {
+            return this->first[0];
+        }
+
+        reference operator[](size_t index){
+            return this->first[index];
+        }
+
+        const_reference operator[](size_t index) const {
+            return this->first[index];
+        }
+
+        size_t size() const {
+            return this->count;
+        }
+
+        size_t capacity() const {
+            return this->room;
+        }
+
+        bool empty() const {
+            return this->count == 0;
+        }
+
+        allocator_type get_allocator() const {
+            return this->allocator;
+        }
+
+        // ? true while no element went to the heap
+        bool inlined() const {
+            return this->isInline();
+        }
+
+        iterator begin(){
+            return this->first;
+        }
+
+        iterator end(){
+            return this->first + this->count;
+        }
+
+        const_iterator begin() const {
+            return this->first;
+        }
+
+        const_iterator end() const {
+            return this->first + this->count;
+        }
+};
+
+// * Comparisons, used by the comparisons of std::stack
+template<typename T, size_t N, typename Allocator>
+bool operator==(const SmallVector<T, N, Allocator> &a, const SmallVector<T, N, Allocator> &b){
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+template<typename T, size_t N, typename Allocator>
+bool operator<(const SmallVector<T, N, Allocator> &a, const SmallVector<T, N, Allocator> &b){
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+#endif
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   StackTraits.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:38:54 by mdahani           #+#    #+#             */
+/*   Updated: 2026/10/17 19:38:54 by mdahani          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STACKTRAITS_HPP
+# define STACKTRAITS_HPP
+
+// * Includes
+#include <cstddef>
+
+// * Detection of the capacity methods that only some storages have
+// ? reserve(): std::vector and SmallVector, shrink_to_fit(): SmallVector, and the standard containers since C++11
+// ? Check<U, &U::reserve> is only a valid type when U has that method with exactly this signature,
+// ? so an overloaded or differently typed reserve() doesn't count: the catch-all test(...) answers then
+template<typename T>
+struct HasReserve {
+    template<typename U, void (U::*)(typename U::size_type)>
+    struct Check {};
+    template<typename U>
+    static char test(Check<U, &U::reserve> *);
+    template<typename U>
+    static long test(...);
+    enum { value = sizeof(test<T>(0)) == sizeof(char) };
+};
+
+template<typename T>
+struct HasShrinkToFit {
+    template<typename U, void (U::*)()>
+    struct Check {};
+    template<typename U>
+    static char test(Check<U, &U::shrink_to_fit> *);
+    template<typename U>
+    static long test(...);
+    enum { value = sizeof(test<T>(0)) == sizeof(char) };
+};
+
+// * reserve() of a storage, nothing when it has none (std::deque, std::list)
+template<typename Container, bool reservable = HasReserve<Container>::value>
+struct ReserveOf {
+    static void reserve(Container &, size_t){
+    }
+};
+
+template<typename Container>
+struct ReserveOf<Container, true> {
+    static void reserve(Container &container, size_t capacity){
+        container.reserve(capacity);
+    }
+};
+
+// * shrink_to_fit() of a storage
+// ? before C++11 std::vector has reserve() but no shrink_to_fit(): a copy has the exact capacity, it's swapped in
+// ? a storage that has neither keeps its memory
+template<typename Container, bool shrinkable = HasShrinkToFit<Container>::value, bool reservable = HasReserve<Container>::value>
+struct ShrinkOf {
+    static void shrink(Container &){
+    }
+};
+
+template<typename Container, bool reservable>
+struct ShrinkOf<Container, true, reservable> {
+    static void shrink(Container &container){
+        container.shrink_to_fit();
+    }
+};
+
+template<typename Container>
+struct ShrinkOf<Container, false, true> {
+    static void shrink(Container &container){
+        Container(container).swap(container);
+    }
+};
+#endif
@@ -6,11 +6,14 @@
 /*   By: mdahani <mdahani@student.42.fr>            +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/06 18:34:27 by mdahani           #+#    #+#             */
-/*   Updated: 2025/11/08 09:58:18 by mdahani          ###   ########.fr       */
+/*   Updated: 2026/10/17 20:06:56 by mdahani          ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "MutantStack.hpp"
+#include "ConcurrentStack.hpp"
+#include <vector>
+#include <iterator>
 
 int main()
 {
@@ -71,5 +74,99 @@ int main()
         std::cout << mstack_const.top() << std::endl;
     }
 
+    std::cout << "==========================" << std::endl;
+
+    // * Over a vector: contiguous elements
+    MutantStack<int, std::vector<int> > vstack;
+    for (int i = 0; i < 5; i++){
+        vstack.push(i * 10);
+    }
+    for (MutantStack<int, std::vector<int> >::iterator it3 = vstack.begin(); it3 != vstack.end(); ++it3){
+        std::cout << *it3 << std::endl;
+    }
+
+    // 0
+    // 10
+    // 20
+    // 30
+    // 40
+
+    std::cout << "==========================" << std::endl;
+
+    // * Over a SmallVector: no heap allocation for the first 8 elements
+    MutantStack<int, SmallVector<int, 8> > sstack;
+    for (int i = 0; i < 8; i++){
+        sstack.push(i);
+    }
+    std::cout << sstack.top() << " " << sstack.begin()[0] << std::endl; // 7 0
+    sstack.push(8);
+    std::cout << sstack.size() << " " << sstack.top() << std::endl; // 9 8
+
+    std::cout << "==========================" << std::endl;
+
+    // * Bulk: a whole range in one push, the top elements out in one pop
+    int tokens[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    MutantStack<int, SmallVector<int, 8> > bstack;
+    bstack.push_range(tokens, tokens + 10);
+    std::cout << bstack.size() << " " << bstack.top() << std::endl; // 10 10
+    std::vector<int> drained;
+    bstack.pop(3, std::back_inserter(drained));
+    std::cout << drained[0] << " " << drained[1] << " " << drained[2] << " " << bstack.top() << std::endl; // 10 9 8 7
+    bstack.pop(bstack.size() - 2, std::back_inserter(drained));
+    bstack.shrink_to_fit();
+    std::cout << bstack.size() << " " << bstack.top() << std::endl; // 2 2
+    MutantStack<int, std::vector<int> > rstack;
+    rstack.reserve(100);
+    rstack.push_range(tokens, tokens + 10);
+    rstack.shrink_to_fit();
+    std::cout << rstack.size() << " " << rstack.top() << std::endl; // 10 10
+
+    std::cout << "==========================" << std::endl;
+
+    // * With an allocator: the stacks of a batch take their memory from one arena, released at once
+    Arena arena;
+    {
+        MutantStack<int, std::deque<int, ArenaAllocator<int> > > astack((ArenaAllocator<int>(arena)));
+        MutantStack<int, std::vector<int, PoolAllocator<int> > > pstack((PoolAllocator<int>()));
+        for (int i = 0; i < 100; i++){
+            astack.push(i);
+            pstack.push(i * 2);
+        }
+        std::cout << astack.top() << " " << pstack.top() << std::endl; // 99 198
+    }
+    arena.reset();
+
+    std::cout << "==========================" << std::endl;
+
+    // * Lock-free: push and pop from any thread, iterate on a snapshot
+    ConcurrentStack<int> cstack;
+    for (int i = 1; i <= 4; i++){
+        cstack.push(i);
+    }
+    int popped;
+    cstack.pop(popped);
+    std::vector<int> snapshot = cstack.snapshot();
+    std::cout << popped << " " << snapshot.size() << std::endl; // 4 3
+    for (std::vector<int>::const_iterator it4 = snapshot.begin(); it4 != snapshot.end(); ++it4){
+        std::cout << *it4 << std::endl;
+    }
+
+    // 1
+    // 2
+    // 3
+
+    std::cout << "==========================" << std::endl;
+
+    // * Counting policy: no output, the events are read from the counters
+    {
+        typedef MutantStack<int, std::deque<int>, CountingLog> CountedStack;
+        CountedStack first;
+        CountedStack second(first);
+        second = first;
+    }
+    LifecycleCounters counters = CountingLog::counters<MutantStack<int, std::deque<int>, CountingLog> >();
+    std::cout << counters.defaultConstructed << " " << counters.copyConstructed << " "
+              << counters.copyAssigned << " " << counters.destroyed << std::endl; // 1 1 1 2
+
     return 0;
 }
\ No newline at end of file